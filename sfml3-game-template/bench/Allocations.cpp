@@ -0,0 +1,57 @@
+// Counting replacements for the global allocation functions (bench target only), so a
+// benchmark can report how many heap allocations the code it measures made.
+
+#include "Bench.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<std::size_t> g_Allocations{ 0 };
+}
+
+namespace bench
+{
+    std::size_t allocationCount() noexcept
+    {
+        return g_Allocations.load(std::memory_order_relaxed);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
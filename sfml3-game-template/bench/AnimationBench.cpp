@@ -0,0 +1,142 @@
+#include "Bench.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/AnimationSheet.hpp"
+#include "ECS/Components.hpp"
+#include "ECS/SpriteBatch.hpp"
+#include "ECS/Systems.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <print>
+#include <vector>
+
+// Set by the bench target to the source tree's sfml3-game-template/ directory
+#ifndef BENCH_PROJECT_DIR
+    #define BENCH_PROJECT_DIR "."
+#endif
+
+namespace
+{
+    constexpr std::size_t Animated = 100'000;
+    constexpr int Frames = 60;
+    constexpr int Runs = 5;
+    constexpr int WorldSize = 8'000;
+
+    const sf::Time FrameTime = sf::seconds(1.0f / 60.0f);
+
+    // Spread over a large world so the LOD case has near, far and offscreen entities
+    sf::Vector2f positionFor(std::size_t index)
+    {
+        return { static_cast<float>((index * 37) % WorldSize),
+                 static_cast<float>((index * 91) % WorldSize) };
+    }
+
+    // Staggered timers so frame changes are spread over the frames, as in a real scene
+    AnimatorComponent animatorFor(const AnimationSheet& sheet, std::size_t index)
+    {
+        AnimatorComponent animator;
+        animator.sheet = &sheet;
+        animator.clip = static_cast<ClipID>(index % sheet.getClipCount());
+        const AnimationClip& clip = sheet.getClip(animator.clip);
+        animator.currentFrame = static_cast<std::uint8_t>(index % clip.frameCount);
+        animator.elapsedTime = clip.timePerFrame * static_cast<float>(index % 7) / 7.0f;
+        return animator;
+    }
+
+    void runFrames(entt::registry& registry)
+    {
+        for (int frame = 0; frame < Frames; ++frame)
+        {
+            CoreSystems::animationSystem(registry, FrameTime);
+        }
+    }
+}
+
+namespace bench
+{
+    void runAnimationBenchmarks()
+    {
+        const std::filesystem::path sheetPath =
+            std::filesystem::path(BENCH_PROJECT_DIR) / "resources/sprites/knight.toml";
+
+        AnimationSheet sheet;
+        if (!sheet.loadFromFile(sheetPath.string()) || sheet.getClipCount() == 0)
+        {
+            std::println("\nNo clips in {}; animation benchmarks skipped.", sheetPath.string());
+            return;
+        }
+
+        section("animationSystem: 100k animated entities, knight clips, 60 frames");
+
+        const sf::Texture texture;
+        const sf::IntRect firstFrame = sheet.getFrameRect(0);
+
+        {
+            entt::registry registry;
+            std::vector<entt::entity> entities(Animated);
+            registry.create(entities.begin(), entities.end());
+            for (std::size_t i = 0; i < Animated; ++i)
+            {
+                auto& spriteComp = registry.emplace<SpriteComponent>(
+                    entities[i], sf::Sprite(texture, firstFrame));
+                spriteComp.sprite.setPosition(positionFor(i));
+                registry.emplace<AnimatorComponent>(entities[i], animatorFor(sheet, i));
+            }
+
+            measure("SpriteComponent rects", Animated * Frames, Runs, [&]
+            {
+                runFrames(registry);
+            });
+        }
+
+        entt::registry registry;
+        const auto batchEntity = registry.create();
+        auto& batch = registry.emplace<SpriteBatch>(batchEntity, texture);
+        batch.reserve(Animated);
+
+        std::vector<entt::entity> entities(Animated);
+        registry.create(entities.begin(), entities.end());
+        const sf::Vector2f frameSize(sheet.getFrameSize());
+        for (std::size_t i = 0; i < Animated; ++i)
+        {
+            const auto quad = batch.addQuad({ positionFor(i), frameSize }, firstFrame);
+            registry.emplace<BatchedSprite>(entities[i], batchEntity, quad);
+            registry.emplace<AnimatorComponent>(entities[i], animatorFor(sheet, i));
+        }
+
+        measure("SpriteBatch UVs", Animated * Frames, Runs, [&]
+        {
+            runFrames(registry);
+        });
+
+        // A 1280x720 camera in one corner: most entities are offscreen and tick every 4-8 frames
+        for (std::size_t i = 0; i < Animated; ++i)
+        {
+            auto& lod = registry.emplace<UpdateLOD>(entities[i]);
+            lod.phase = static_cast<std::uint8_t>(i % 8);
+        }
+        const sf::View camera({ 640.0f, 360.0f }, { 1280.0f, 720.0f });
+
+        measure("SpriteBatch UVs + updateLODSystem", Animated * Frames, Runs, [&]
+        {
+            for (int frame = 0; frame < Frames; ++frame)
+            {
+                CoreSystems::updateLODSystem(registry, FrameTime, camera, camera.getCenter());
+                CoreSystems::animationSystem(registry, FrameTime);
+            }
+        });
+
+        const auto& stats = registry.ctx().get<UpdateLODStats>();
+        std::println("    last frame: {} ticked, {} skipped", stats.ticked, stats.skipped);
+        consume(batch.getActiveQuadCount());
+    }
+}
@@ -0,0 +1,125 @@
+#include "Bench.hpp"
+
+#include "Utilities/FileReader.hpp"
+#include "Utilities/ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <print>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// Set by the bench target to the source tree's sfml3-game-template/ directory
+#ifndef BENCH_PROJECT_DIR
+    #define BENCH_PROJECT_DIR "."
+#endif
+
+namespace
+{
+    // The template's resources are only a few files, so each batch reads them several times
+    constexpr int Copies = 16;
+    constexpr int Runs = 20;
+
+    std::vector<std::string> collectFiles(const std::filesystem::path& directory)
+    {
+        std::vector<std::string> paths;
+        std::error_code error;
+        for (std::filesystem::recursive_directory_iterator it(directory, error), end;
+             !error && it != end; it.increment(error))
+        {
+            if (it->is_regular_file(error))
+            {
+                paths.push_back(it->path().string());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+    std::uint64_t countBytes(const utils::FileBatch& batch)
+    {
+        std::uint64_t bytes = 0;
+        for (const auto& file : batch.files)
+        {
+            bytes += file.loaded ? file.bytes.size() : 0;
+        }
+        return bytes;
+    }
+
+    // What loadFromFile() amounts to: open, read whole, close, one file after the other
+    std::uint64_t readWithStreams(const std::vector<std::string>& paths)
+    {
+        std::uint64_t bytes = 0;
+        for (const auto& path : paths)
+        {
+            std::ifstream stream(path, std::ios::binary);
+            const std::vector<char> contents((std::istreambuf_iterator<char>(stream)),
+                                             std::istreambuf_iterator<char>());
+            bytes += contents.size();
+        }
+        return bytes;
+    }
+}
+
+namespace bench
+{
+    void runAssetLoadBenchmarks()
+    {
+        const std::filesystem::path resources =
+            std::filesystem::path(BENCH_PROJECT_DIR) / "resources";
+        const std::vector<std::string> files = collectFiles(resources);
+        if (files.empty())
+        {
+            std::println("\nNo files in {}; asset read benchmarks skipped.", resources.string());
+            return;
+        }
+
+        std::vector<std::string> paths;
+        paths.reserve(files.size() * Copies);
+        for (int copy = 0; copy < Copies; ++copy)
+        {
+            paths.insert(paths.end(), files.begin(), files.end());
+        }
+
+        utils::ThreadPool threadPool;
+        const utils::FileBatch probe = utils::readFiles(paths, &threadPool);
+
+        // After the warm-up run every file is in the page cache: this measures the cost of
+        // issuing the reads, not of the disk. Drop the caches between runs for cold numbers.
+        section(std::format("Asset file reads: {} files ({} x {}), {:.1f} KiB per batch, warm cache",
+                            paths.size(), Copies, files.size(),
+                            static_cast<double>(countBytes(probe)) / 1024.0));
+
+        measure("ifstream, one file at a time (baseline)", paths.size(), Runs, [&]
+        {
+            consume(readWithStreams(paths));
+        });
+        measure("readFiles, serial pread", paths.size(), Runs, [&]
+        {
+            consume(countBytes(utils::readFiles(paths, nullptr, utils::FileReadBackend::Serial)));
+        });
+        measure(std::format("readFiles, pread on {} workers", threadPool.getThreadCount()),
+                paths.size(), Runs, [&]
+        {
+            consume(countBytes(utils::readFiles(paths, &threadPool,
+                                                utils::FileReadBackend::ThreadPool)));
+        });
+
+        if (probe.backend != utils::FileReadBackend::IoUring)
+        {
+            std::println("    io_uring unavailable (not built with USE_IO_URING, or refused by "
+                         "the kernel); readFiles() uses the {} path", utils::toString(probe.backend));
+            return;
+        }
+        measure("readFiles, io_uring", paths.size(), Runs, [&]
+        {
+            consume(countBytes(utils::readFiles(paths, &threadPool, utils::FileReadBackend::IoUring)));
+        });
+    }
+}
@@ -0,0 +1,68 @@
+// Tiny timing harness for the micro-benchmarks (sfml3-game-template-bench target).
+// No framework: each case runs once to warm up, then 'runs' times on steady_clock,
+// and prints the best and mean run plus the cost per operation.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <print>
+#include <string_view>
+
+namespace bench
+{
+    // Keeps results alive so the optimizer can't drop the measured work
+    inline volatile std::uint64_t g_Sink = 0;
+
+    inline void consume(std::uint64_t value)
+    {
+        g_Sink = g_Sink + value;
+    }
+
+    inline void section(std::string_view title)
+    {
+        std::println("\n----- {} -----", title);
+    }
+
+    // 'run' performs 'opsPerRun' operations of the case being measured
+    template<typename Run>
+    void measure(std::string_view name, std::size_t opsPerRun, int runs, Run&& run)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        run();
+
+        double best = std::numeric_limits<double>::max();
+        double total = 0.0;
+        for (int i = 0; i < runs; ++i)
+        {
+            const auto start = Clock::now();
+            run();
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            best = std::min(best, ms);
+            total += ms;
+        }
+
+        const double mean = total / static_cast<double>(std::max(runs, 1));
+        const double nsPerOp = opsPerRun ? best * 1.0e6 / static_cast<double>(opsPerRun) : 0.0;
+        std::println("{:<48} best {:>9.3f} ms  mean {:>9.3f} ms  {:>10.1f} ns/op",
+                     name, best, mean, nsPerOp);
+    }
+
+    // Global operator new calls so far (counted by bench/Allocations.cpp)
+    std::size_t allocationCount() noexcept;
+
+    //$ ----- Groups (one per file) ----- //
+
+    void runPoolBenchmarks();
+    void runGridBenchmarks();
+    void runCollisionBenchmarks();
+    void runTweenBenchmarks();
+    void runAnimationBenchmarks();
+    void runInlineFunctionBenchmarks();
+    void runAssetLoadBenchmarks();
+    void runManifestLoadBenchmarks();
+}
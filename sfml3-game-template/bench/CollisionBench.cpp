@@ -0,0 +1,237 @@
+#include "Bench.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Collision.hpp"
+#include "ECS/Components.hpp"
+#include "ECS/PixelMask.hpp"
+#include "ECS/Systems.hpp"
+
+#include <cstddef>
+#include <format>
+#include <print>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t Bodies = 20'000;
+    constexpr int Steps = 20;
+    constexpr int Runs = 5;
+
+    // 16px bodies over 4096x4096: a few touching pairs per body on average
+    constexpr float WorldSize = 4096.0f;
+    constexpr int BodySize = 16;
+
+    struct Scene
+    {
+        entt::registry registry;
+        std::vector<entt::entity> entities;
+        std::vector<sf::Vector2f> velocities;
+    };
+
+    // No GL needed: the sprites only carry bounds, the texture is never uploaded
+    void buildScene(Scene& scene, const sf::Texture& texture, float circleShare, float fastShare)
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> coord(0.0f, WorldSize);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> slow(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> fast(-40.0f, 40.0f);
+
+        scene.entities.resize(Bodies);
+        scene.registry.create(scene.entities.begin(), scene.entities.end());
+        scene.velocities.resize(Bodies);
+
+        for (std::size_t i = 0; i < Bodies; ++i)
+        {
+            const auto entity = scene.entities[i];
+            auto& spriteComp = scene.registry.emplace<SpriteComponent>(
+                entity, sf::Sprite(texture, sf::IntRect({ 0, 0 }, { BodySize, BodySize })));
+            spriteComp.sprite.setPosition({ coord(rng), coord(rng) });
+
+            Collider collider;
+            collider.shape = unit(rng) < circleShare ? ColliderShape::Circle : ColliderShape::Box;
+            scene.registry.emplace<Collider>(entity, collider);
+
+            scene.velocities[i] = unit(rng) < fastShare ? sf::Vector2f{ fast(rng), fast(rng) }
+                                                        : sf::Vector2f{ slow(rng), slow(rng) };
+        }
+    }
+
+    void moveBodies(Scene& scene)
+    {
+        for (std::size_t i = 0; i < Bodies; ++i)
+        {
+            scene.registry.get<SpriteComponent>(scene.entities[i]).sprite.move(scene.velocities[i]);
+        }
+    }
+
+    void runScene(std::string_view name, const sf::Texture& texture, float circleShare,
+                  float fastShare)
+    {
+        Scene scene;
+        buildScene(scene, texture, circleShare, fastShare);
+
+        // First step: every body is inserted and the whole list sorted
+        bench::measure(std::format("{}: first step", name), Bodies, Runs, [&]
+        {
+            scene.registry.ctx().erase<CollisionWorld>();
+            CoreSystems::collisionSystem(scene.registry);
+        });
+
+        bench::measure(std::format("{}: {} moving steps", name, Steps), Bodies * Steps, Runs, [&]
+        {
+            for (int step = 0; step < Steps; ++step)
+            {
+                moveBodies(scene);
+                CoreSystems::collisionSystem(scene.registry);
+            }
+        });
+
+        const auto& stats = scene.registry.ctx().get<CollisionWorld>().stats;
+        std::println("    last step: {} pairs, {} swept tests, {} contacts, {} sort swaps",
+                     stats.candidatePairs, stats.sweptTests, stats.contacts, stats.sortSwaps);
+        bench::consume(stats.contacts);
+    }
+
+    // A filled disc on a transparent frame, like a round sprite with empty corners
+    PixelMask buildDiscMask(int size)
+    {
+        sf::Image image({ static_cast<unsigned int>(size), static_cast<unsigned int>(size) },
+                        sf::Color::Transparent);
+        const float radius = static_cast<float>(size) / 2.0f;
+        for (int y = 0; y < size; ++y)
+        {
+            for (int x = 0; x < size; ++x)
+            {
+                const sf::Vector2f offset(static_cast<float>(x) + 0.5f - radius,
+                                          static_cast<float>(y) + 0.5f - radius);
+                if (offset.lengthSquared() <= radius * radius)
+                {
+                    image.setPixel({ static_cast<unsigned int>(x), static_cast<unsigned int>(y) },
+                                   sf::Color::White);
+                }
+            }
+        }
+
+        PixelMask mask;
+        mask.build(image, sf::IntRect({ 0, 0 }, { size, size }));
+        return mask;
+    }
+}
+
+namespace bench
+{
+    void runCollisionBenchmarks()
+    {
+        section("collisionSystem: 20k bodies");
+
+        const sf::Texture texture;
+        runScene("boxes, slow", texture, 0.0f, 0.0f);
+        runScene("boxes, 10% fast", texture, 0.0f, 0.1f);
+        runScene("half circles, 10% fast", texture, 0.5f, 0.1f);
+
+        section("Collision narrow phase: 1M tests");
+
+        constexpr std::size_t Tests = 1'000'000;
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> offset(-20.0f, 20.0f);
+        std::vector<sf::Vector2f> offsets(Tests);
+        for (auto& value : offsets)
+        {
+            value = { offset(rng), offset(rng) };
+        }
+
+        const sf::FloatRect box({ 0.0f, 0.0f }, { 16.0f, 16.0f });
+        const sf::Vector2f center = box.getCenter();
+
+        measure("boxBox", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                hits += Collision::boxBox(box, { box.position + value, box.size }).has_value();
+            }
+            consume(hits);
+        });
+
+        measure("circleCircle", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                hits += Collision::circleCircle(center, 8.0f, center + value, 8.0f).has_value();
+            }
+            consume(hits);
+        });
+
+        measure("sweptBoxBox (40px moves)", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                const sf::FloatRect start({ -40.0f, value.y }, box.size);
+                hits += Collision::sweptBoxBox(start, { 80.0f, value.x }, box).has_value();
+            }
+            consume(hits);
+        });
+
+        measure("sweptCircleCircle (40px moves)", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                hits += Collision::sweptCircleCircle({ -40.0f, center.y + value.y }, 8.0f,
+                                                     { 80.0f, value.x }, center, 8.0f).has_value();
+            }
+            consume(hits);
+        });
+
+        // Pairs whose boxes touch (offsets within +-20px of 32px frames); the empty corners
+        // make some of them pixel misses
+        section("Pixel masks: 1M tests, 32x32 disc frames");
+
+        const PixelMask disc = buildDiscMask(32);
+        const PixelCollision::Placement placement{ &disc, { { 0.0f, 0.0f }, { 32.0f, 32.0f } } };
+
+        measure("overlap, same scale (word-wide)", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                const PixelCollision::Placement other{ &disc, { value, placement.bounds.size } };
+                hits += PixelCollision::overlap(placement, other);
+            }
+            consume(hits);
+        });
+
+        measure("overlap, 2x scale (sampled)", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                const PixelCollision::Placement other{ &disc, { value * 2.0f, { 64.0f, 64.0f } } };
+                hits += PixelCollision::overlap(placement, other);
+            }
+            consume(hits);
+        });
+
+        measure("overlapRect (16px box)", Tests, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& value : offsets)
+            {
+                hits += PixelCollision::overlapRect(placement, { box.position + value, box.size });
+            }
+            consume(hits);
+        });
+    }
+}
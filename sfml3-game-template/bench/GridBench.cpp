@@ -0,0 +1,127 @@
+#include "Bench.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/SpatialGrid.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t Entities = 100'000;
+    constexpr std::size_t Queries = 10'000;
+    constexpr int Runs = 10;
+
+    // 64px cells over a 8192x8192 world: ~16k cells, ~6 entities per cell
+    const sf::FloatRect WorldBounds{ { 0.0f, 0.0f }, { 8192.0f, 8192.0f } };
+    constexpr float CellSize = 64.0f;
+    const sf::Vector2f EntitySize{ 16.0f, 16.0f };
+}
+
+namespace bench
+{
+    void runGridBenchmarks()
+    {
+        section("SpatialGrid: 100k entities, 64px cells");
+
+        entt::registry registry;
+        std::vector<entt::entity> entities(Entities);
+        registry.create(entities.begin(), entities.end());
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> coord(0.0f, WorldBounds.size.x - EntitySize.x);
+        std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+        std::uniform_real_distribution<float> jump(-48.0f, 48.0f);
+
+        std::vector<sf::Vector2f> positions(Entities);
+        for (auto& position : positions)
+        {
+            position = { coord(rng), coord(rng) };
+        }
+
+        SpatialGrid grid(WorldBounds, CellSize);
+
+        measure("insert 100k (reset + update)", Entities, Runs, [&]
+        {
+            grid.reset(WorldBounds, CellSize);
+            for (std::size_t i = 0; i < Entities; ++i)
+            {
+                grid.update(entities[i], { positions[i], EntitySize });
+            }
+        });
+
+        // Small moves mostly stay inside the same cells (the spatialIndexSystem fast path)
+        measure("update 100k, 2px moves", Entities, Runs, [&]
+        {
+            for (std::size_t i = 0; i < Entities; ++i)
+            {
+                positions[i] += { jitter(rng), jitter(rng) };
+                grid.update(entities[i], { positions[i], EntitySize });
+            }
+        });
+
+        measure("update 100k, 48px moves", Entities, Runs, [&]
+        {
+            for (std::size_t i = 0; i < Entities; ++i)
+            {
+                positions[i] += { jump(rng), jump(rng) };
+                grid.update(entities[i], { positions[i], EntitySize });
+            }
+        });
+
+        std::vector<sf::Vector2f> probes(Queries);
+        for (auto& probe : probes)
+        {
+            probe = { coord(rng), coord(rng) };
+        }
+
+        measure("queryPoint x10k", Queries, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& probe : probes)
+            {
+                hits += grid.queryPoint(probe).size();
+            }
+            consume(hits);
+        });
+
+        measure("queryRadius 200px x10k", Queries, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& probe : probes)
+            {
+                hits += grid.queryRadius(probe, 200.0f).size();
+            }
+            consume(hits);
+        });
+
+        measure("queryRay 800px x10k", Queries, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (const auto& probe : probes)
+            {
+                hits += grid.queryRay(probe, { 1.0f, 0.5f }, 800.0f).size();
+            }
+            consume(hits);
+        });
+
+        // Baseline for the queries: testing every entity
+        measure("brute-force radius 200px x100", 100, Runs, [&]
+        {
+            std::size_t hits = 0;
+            for (std::size_t q = 0; q < 100; ++q)
+            {
+                for (const auto& position : positions)
+                {
+                    const sf::Vector2f d = position - probes[q];
+                    hits += (d.lengthSquared() <= 200.0f * 200.0f) ? 1u : 0u;
+                }
+            }
+            consume(hits);
+        });
+    }
+}
@@ -0,0 +1,126 @@
+#include "Bench.hpp"
+
+#include "Utilities/InlineFunction.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <print>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t Callables = 10'000;
+    constexpr int Calls = 100;
+    constexpr std::size_t Constructions = 1'000'000;
+    constexpr int Runs = 10;
+
+    // Capture sizes of the callbacks in the tree: UI actions are [this] or [this, entity],
+    // a few timer/task callbacks carry a couple of pointers more
+    struct SmallCapture
+    {
+        std::uint64_t* counter;
+        std::uint64_t step;
+
+        void operator()() const { *counter += step; }
+    };
+
+    struct LargeCapture
+    {
+        std::uint64_t* counter;
+        std::uint64_t step;
+        const void* owner;
+        std::uint64_t entity;
+
+        void operator()() const { *counter += step + (owner ? entity : 0); }
+    };
+
+    void addOne(std::uint64_t* counter)
+    {
+        ++*counter;
+    }
+
+    // Builds, moves and destroys 'Constructions' callables and reports allocations per
+    // callable (InlineFunction is move-only, so both types are moved, not copied)
+    template<typename Function, typename Callable>
+    void measureConstruction(std::string_view name, const Callable& callable)
+    {
+        const std::size_t before = bench::allocationCount();
+        bench::measure(name, Constructions, Runs, [&]
+        {
+            for (std::size_t i = 0; i < Constructions; ++i)
+            {
+                Function function(callable);
+                Function moved(std::move(function));
+                bench::consume(static_cast<bool>(moved));
+            }
+        });
+        const std::size_t allocations = bench::allocationCount() - before;
+        const double perCallable = static_cast<double>(allocations)
+                                 / static_cast<double>(Constructions * (Runs + 1) * 2);
+        std::println("    {:.2f} heap allocations per callable", perCallable);
+    }
+
+    template<typename Function, typename Callable>
+    void measureDispatch(std::string_view name, const Callable& callable)
+    {
+        std::vector<Function> functions;
+        functions.reserve(Callables);
+        for (std::size_t i = 0; i < Callables; ++i)
+        {
+            functions.emplace_back(callable);
+        }
+
+        const std::size_t before = bench::allocationCount();
+        bench::measure(name, Callables * Calls, Runs, [&]
+        {
+            for (int call = 0; call < Calls; ++call)
+            {
+                for (auto& function : functions)
+                {
+                    function();
+                }
+            }
+        });
+        std::println("    {} heap allocations while calling", bench::allocationCount() - before);
+    }
+}
+
+namespace bench
+{
+    void runInlineFunctionBenchmarks()
+    {
+        std::uint64_t counter = 0;
+        const SmallCapture small{ &counter, 1 };
+        const LargeCapture large{ &counter, 1, &counter, 7 };
+
+        section("Callback construction + move (1M each)");
+        measureConstruction<std::function<void()>>("std::function, 16-byte capture", small);
+        measureConstruction<utils::InlineFunction<void(), 32>>("InlineFunction<32>, 16-byte capture", small);
+        measureConstruction<std::function<void()>>("std::function, 32-byte capture", large);
+        measureConstruction<utils::InlineFunction<void(), 32>>("InlineFunction<32>, 32-byte capture", large);
+
+        section("Callback dispatch: 10k callables x 100 calls");
+        {
+            std::vector<void (*)(std::uint64_t*)> pointers(Callables, &addOne);
+            measure("function pointer (baseline)", Callables * Calls, Runs, [&]
+            {
+                for (int call = 0; call < Calls; ++call)
+                {
+                    for (auto* pointer : pointers)
+                    {
+                        pointer(&counter);
+                    }
+                }
+            });
+        }
+        measureDispatch<std::function<void()>>("std::function, 16-byte capture", small);
+        measureDispatch<utils::InlineFunction<void(), 32>>("InlineFunction<32>, 16-byte capture", small);
+        measureDispatch<std::function<void()>>("std::function, 32-byte capture", large);
+        measureDispatch<utils::InlineFunction<void(), 32>>("InlineFunction<32>, 32-byte capture", large);
+
+        consume(counter);
+    }
+}
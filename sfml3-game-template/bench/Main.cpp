@@ -0,0 +1,53 @@
+#include "Bench.hpp"
+
+#include <print>
+#include <string_view>
+
+namespace
+{
+    struct Group
+    {
+        std::string_view name;
+        void (*run)();
+    };
+
+    constexpr Group Groups[] = {
+        { "pool", &bench::runPoolBenchmarks },
+        { "grid", &bench::runGridBenchmarks },
+        { "collision", &bench::runCollisionBenchmarks },
+        { "tween", &bench::runTweenBenchmarks },
+        { "animation", &bench::runAnimationBenchmarks },
+        { "function", &bench::runInlineFunctionBenchmarks },
+        { "assets", &bench::runAssetLoadBenchmarks },
+        { "manifest", &bench::runManifestLoadBenchmarks },
+    };
+}
+
+// Usage: sfml3-game-template-bench [group]   (no argument runs every group)
+int main(int argc, char* argv[])
+{
+    const std::string_view filter = (argc > 1) ? argv[1] : "";
+
+    bool ranAny = false;
+    for (const auto& group : Groups)
+    {
+        if (filter.empty() || filter == group.name)
+        {
+            group.run();
+            ranAny = true;
+        }
+    }
+
+    if (!ranAny)
+    {
+        std::println("Unknown benchmark group \"{}\". Groups:", filter);
+        for (const auto& group : Groups)
+        {
+            std::println("  {}", group.name);
+        }
+        return 1;
+    }
+
+    std::println("\n(sink {})", static_cast<unsigned long long>(bench::g_Sink));
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "Bench.hpp"
+
+#include "Managers/ResourceManager.hpp"
+#include "Utilities/Logger.hpp"
+#include "Utilities/ThreadPool.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <print>
+#include <system_error>
+
+// Set by the bench target to the source tree's sfml3-game-template/ directory
+#ifndef BENCH_PROJECT_DIR
+    #define BENCH_PROJECT_DIR "."
+#endif
+
+namespace
+{
+    constexpr int Runs = 10;
+    constexpr const char* ManifestPath = "config/AssetsManifest.toml";
+
+    // The manifest's asset paths are relative to the project directory, as for the game
+    class ScopedWorkingDirectory
+    {
+    public:
+        explicit ScopedWorkingDirectory(const std::filesystem::path& directory)
+            : m_Previous(std::filesystem::current_path(m_Error))
+        {
+            std::filesystem::current_path(directory, m_Error);
+        }
+        ScopedWorkingDirectory(const ScopedWorkingDirectory&) = delete;
+        ScopedWorkingDirectory& operator=(const ScopedWorkingDirectory&) = delete;
+        ~ScopedWorkingDirectory()
+        {
+            std::error_code ignored;
+            std::filesystem::current_path(m_Previous, ignored);
+        }
+
+        bool isValid() const noexcept { return !m_Error; }
+
+    private:
+        std::error_code m_Error;
+        std::filesystem::path m_Previous;
+    };
+}
+
+namespace bench
+{
+    void runManifestLoadBenchmarks()
+    {
+        const ScopedWorkingDirectory directory(BENCH_PROJECT_DIR);
+        if (!directory.isValid() || !std::filesystem::exists(ManifestPath))
+        {
+            std::println("\nNo {} in {}; manifest load benchmarks skipped.", ManifestPath,
+                         BENCH_PROJECT_DIR);
+            return;
+        }
+
+        // The per-asset report would flood the output; errors still show
+        const logger::LogLevel previousLevel = logger::getLevel();
+        logger::setLevel(logger::LogLevel::Error);
+
+        // Textures are uploaded, so this needs a GL context (SFML makes a hidden one)
+        utils::ThreadPool threadPool;
+        section(std::format("loadAssetsFromManifest: {}, warm cache", ManifestPath));
+
+        measure("serial (no thread pool)", 1, Runs, []
+        {
+            ResourceManager resources;
+            resources.loadAssetsFromManifest(ManifestPath);
+        });
+        measure(std::format("parallel ({} workers)", threadPool.getThreadCount()), 1, Runs, [&]
+        {
+            ResourceManager resources;
+            resources.loadAssetsFromManifest(ManifestPath, &threadPool);
+        });
+
+        logger::setLevel(previousLevel);
+    }
+}
@@ -0,0 +1,77 @@
+#include "Bench.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "Managers/EntityPoolManager.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t Bullets = 10'000;
+    constexpr int Waves = 10;
+    constexpr int Runs = 10;
+
+    // Same shape as a bullet: a velocity and a circle (whose vertices are heap allocated)
+    void buildBullet(entt::registry& registry, entt::entity entity)
+    {
+        registry.emplace<Velocity>(entity, sf::Vector2f{ 400.0f, 0.0f });
+        registry.emplace<RenderableCircle>(entity, 4.0f, sf::Color::Yellow, sf::Vector2f{ 0.0f, 0.0f });
+    }
+}
+
+namespace bench
+{
+    void runPoolBenchmarks()
+    {
+        section("EntityPool: 10 waves of 10k bullets spawned then despawned");
+
+        std::vector<entt::entity> live;
+        live.reserve(Bullets);
+
+        {
+            entt::registry registry;
+            measure("create + destroy", Bullets * Waves, Runs, [&]
+            {
+                for (int wave = 0; wave < Waves; ++wave)
+                {
+                    for (std::size_t i = 0; i < Bullets; ++i)
+                    {
+                        const auto entity = registry.create();
+                        buildBullet(registry, entity);
+                        live.push_back(entity);
+                    }
+                    registry.destroy(live.begin(), live.end());
+                    live.clear();
+                }
+            });
+        }
+
+        {
+            entt::registry registry;
+            EntityPool pool(registry, "bench", &buildBullet);
+            pool.prewarm(Bullets);
+            measure("acquire + release (prewarmed pool)", Bullets * Waves, Runs, [&]
+            {
+                for (int wave = 0; wave < Waves; ++wave)
+                {
+                    for (std::size_t i = 0; i < Bullets; ++i)
+                    {
+                        live.push_back(pool.acquire());
+                    }
+                    for (const auto entity : live)
+                    {
+                        pool.release(entity);
+                    }
+                    live.clear();
+                }
+            });
+            consume(pool.getStats().recycled);
+            pool.clear();
+        }
+    }
+}
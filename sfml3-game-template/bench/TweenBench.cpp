@@ -0,0 +1,147 @@
+#include "Bench.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Time.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "ECS/Tween.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t Tweens = 100'000;
+    constexpr int Frames = 60;
+    constexpr int Runs = 5;
+    constexpr float FrameSeconds = 1.0f / 60.0f;
+
+    constexpr auto EasingCount = static_cast<std::size_t>(Easing::Count);
+
+    // Baseline: one struct per tween, easing picked per tween, written back one by one
+    struct NaiveTween
+    {
+        entt::entity entity{ entt::null };
+        Easing easing{ Easing::Linear };
+        float elapsed{ 0.0f };
+        float duration{ 1.0f };
+        float start{ 0.0f };
+        float end{ 1.0f };
+    };
+
+    float easeOne(Easing easing, float x)
+    {
+        switch (easing)
+        {
+        case Easing::QuadIn:     return x * x;
+        case Easing::QuadOut:    return x * (2.0f - x);
+        case Easing::QuadInOut:  return x < 0.5f ? 2.0f * x * x : -1.0f + (4.0f - 2.0f * x) * x;
+        case Easing::CubicIn:    return x * x * x;
+        case Easing::CubicOut:   { const float u = x - 1.0f; return u * u * u + 1.0f; }
+        case Easing::CubicInOut:
+        {
+            const float u = 2.0f * x - 2.0f;
+            return x < 0.5f ? 4.0f * x * x * x : 0.5f * u * u * u + 1.0f;
+        }
+        case Easing::BackOut:
+        {
+            const float u = x - 1.0f;
+            return 1.0f + 2.70158f * u * u * u + 1.70158f * u * u;
+        }
+        case Easing::SmoothStep: return x * x * (3.0f - 2.0f * x);
+        default:                 return x;
+        }
+    }
+
+    Easing easingFor(std::size_t index)
+    {
+        return static_cast<Easing>(index % EasingCount);
+    }
+}
+
+namespace bench
+{
+    void runTweenBenchmarks()
+    {
+        section("Tweens: 100k active, mixed easings, 60 frames");
+
+        entt::registry registry;
+        std::vector<entt::entity> entities(Tweens);
+        registry.create(entities.begin(), entities.end());
+        for (const auto entity : entities)
+        {
+            registry.emplace<HoverBlend>(entity);
+        }
+
+        // Long durations so nothing finishes (and leaves the batch) while measuring
+        const sf::Time duration = sf::seconds(1000.0f);
+
+        TweenWorld world;
+        measure("TweenWorld::add x100k (replacing)", Tweens, Runs, [&]
+        {
+            for (std::size_t i = 0; i < Tweens; ++i)
+            {
+                world.add(entities[i], TweenProperty::HoverBlend, TweenValue::from(0.0f),
+                          TweenValue::from(1.0f), duration, easingFor(i));
+            }
+        });
+
+        measure("HoverBlend: advance + apply (batched)", Tweens * Frames, Runs, [&]
+        {
+            for (int frame = 0; frame < Frames; ++frame)
+            {
+                world.advance(sf::seconds(FrameSeconds), TimeDomain::World);
+                world.apply(registry, TimeDomain::World);
+            }
+        });
+
+        std::vector<NaiveTween> naive(Tweens);
+        for (std::size_t i = 0; i < Tweens; ++i)
+        {
+            naive[i] = { entities[i], easingFor(i), 0.0f, duration.asSeconds(), 0.0f, 1.0f };
+        }
+
+        measure("HoverBlend: per-tween loop (baseline)", Tweens * Frames, Runs, [&]
+        {
+            for (int frame = 0; frame < Frames; ++frame)
+            {
+                for (auto& tween : naive)
+                {
+                    tween.elapsed += FrameSeconds;
+                    const float t = easeOne(tween.easing, std::min(tween.elapsed / tween.duration, 1.0f));
+                    registry.get<HoverBlend>(tween.entity).value = tween.start + (tween.end - tween.start) * t;
+                }
+            }
+        });
+
+        // Four channels and a colour write-back per tween
+        const sf::Texture texture;
+        for (const auto entity : entities)
+        {
+            registry.emplace<SpriteComponent>(entity, sf::Sprite(texture, sf::IntRect({ 0, 0 }, { 8, 8 })));
+        }
+
+        TweenWorld colorWorld;
+        for (std::size_t i = 0; i < Tweens; ++i)
+        {
+            colorWorld.add(entities[i], TweenProperty::SpriteColor, TweenValue::from(sf::Color::White),
+                           TweenValue::from(sf::Color::Transparent), duration, easingFor(i));
+        }
+
+        measure("SpriteColor: advance + apply (batched)", Tweens * Frames, Runs, [&]
+        {
+            for (int frame = 0; frame < Frames; ++frame)
+            {
+                colorWorld.advance(sf::seconds(FrameSeconds), TimeDomain::World);
+                colorWorld.apply(registry, TimeDomain::World);
+            }
+        });
+
+        consume(world.size() + colorWorld.size());
+    }
+}
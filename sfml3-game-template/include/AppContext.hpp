@@ -7,10 +7,25 @@
 #include "Managers/ConfigManager.hpp"
 #include "Managers/WindowManager.hpp"
 #include "Managers/GlobalEventManager.hpp"
+#include "Managers/InputManager.hpp"
 #include "Managers/ResourceManager.hpp"
+#include "Managers/EntityPoolManager.hpp"
+#include "Managers/TimeManager.hpp"
+#include "Managers/TimerManager.hpp"
+#include "Managers/TaskScheduler.hpp"
+#include "ECS/HoverTracker.hpp"
+#include "ECS/Layout.hpp"
+#include "ECS/SpatialGrid.hpp"
+#include "ECS/SpriteBatch.hpp"
+#include "ECS/Tween.hpp"
+#include "Utilities/FramePacer.hpp"
+#include "Utilities/LatencyTracker.hpp"
+#include "Utilities/ThreadPool.hpp"
 #include "AssetKeys.hpp"
 #include "AppData.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 
 class StateManager;
@@ -21,19 +36,48 @@ struct AppContext
         // make ConfigManager and load config files first
         m_ConfigManager = std::make_unique<ConfigManager>();
         m_ConfigManager->loadConfig(Assets::Configs::Window, "config/WindowConfig.toml");
+        m_ConfigManager->loadConfig(Assets::Configs::Input, "config/InputBindings.toml");
 
         // then initialize the stuff that uses those configs
         m_WindowManager = std::make_unique<WindowManager>(*m_ConfigManager);
         m_ResourceManager = std::make_unique<ResourceManager>();
         m_GlobalEventManager = std::make_unique<GlobalEventManager>(this);
+        m_InputManager = std::make_unique<InputManager>(*m_GlobalEventManager);
+        m_InputManager->loadBindings(*m_ConfigManager, Assets::Configs::Input);
         m_MainClock = std::make_unique<sf::Clock>();
+        m_TimeManager = std::make_unique<TimeManager>();
+        m_FramePacer = std::make_unique<utils::FramePacer>();
+        m_LatencyTracker = std::make_unique<utils::LatencyTracker>();
+        // 0 = size the pool from the hardware thread count
+        m_ThreadPool = std::make_unique<utils::ThreadPool>(static_cast<std::size_t>(std::max(
+            m_ConfigManager->getConfigValue<int>(Assets::Configs::Window, "threading", "Workers")
+                .value_or(0), 0)));
         m_Registry = std::make_unique<entt::registry>();
+        m_EntityPoolManager = std::make_unique<EntityPoolManager>(*m_Registry);
+        m_TimerManager = std::make_unique<TimerManager>(*m_Registry);
+        m_TaskScheduler = std::make_unique<TaskScheduler>();
 
         // Set target width / height
         m_AppSettings.targetWidth = m_ConfigManager->getConfigValue<float>(
                       Assets::Configs::Window, "mainWindow", "X").value_or(1280.0f);
         m_AppSettings.targetHeight = m_ConfigManager->getConfigValue<float>(
                       Assets::Configs::Window, "mainWindow", "Y").value_or(720.0f);
+
+        // Spatial index over the target resolution (UI hit testing + proximity queries)
+        SpatialIndex::connect(*m_Registry, { { 0.0f, 0.0f },
+                              { m_AppSettings.targetWidth, m_AppSettings.targetHeight } });
+
+        // Quad slots of destroyed/parked batched sprites
+        SpriteBatches::connect(*m_Registry);
+
+        // Tween storage + hover fades
+        Tweens::connect(*m_Registry);
+
+        // Hover state, fed by pointer events instead of polling
+        HoverTracking::connect(*m_Registry);
+
+        // Re-layout of UI containers when their content changes
+        Layout::connect(*m_Registry);
     }
 
     AppContext(const AppContext&) = delete;
@@ -45,13 +89,25 @@ struct AppContext
     std::unique_ptr<ConfigManager> m_ConfigManager{ nullptr };
     std::unique_ptr<WindowManager> m_WindowManager{ nullptr };
     std::unique_ptr<GlobalEventManager> m_GlobalEventManager{ nullptr };
+    // After the event bus, so it disconnects from it before the bus is destroyed
+    std::unique_ptr<InputManager> m_InputManager{ nullptr };
     std::unique_ptr<ResourceManager> m_ResourceManager{ nullptr };
     std::unique_ptr<sf::Clock> m_MainClock{ nullptr };
+    std::unique_ptr<TimeManager> m_TimeManager{ nullptr };
+    std::unique_ptr<utils::FramePacer> m_FramePacer{ nullptr };
+    std::unique_ptr<utils::LatencyTracker> m_LatencyTracker{ nullptr };
+    std::unique_ptr<utils::ThreadPool> m_ThreadPool{ nullptr };
     std::unique_ptr<entt::registry> m_Registry{ nullptr };
+    // Declared after m_Registry so it's destroyed (and disconnects) before the registry
+    std::unique_ptr<EntityPoolManager> m_EntityPoolManager{ nullptr };
+    std::unique_ptr<TimerManager> m_TimerManager{ nullptr };
+    // Last, so task frames are destroyed while everything they reference still exists
+    std::unique_ptr<TaskScheduler> m_TaskScheduler{ nullptr };
 
     // AppData members
     AppSettings m_AppSettings;
     AppData m_AppData;
+    FrameTiming m_FrameTiming;
 
     // Pointers to Application-level objects
     sf::RenderWindow* m_MainWindow{ nullptr };
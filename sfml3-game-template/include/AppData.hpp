@@ -1,6 +1,8 @@
 #pragma once
 
 #include <SFML/Audio/Sound.hpp>
+#include <SFML/System/Time.hpp>
+#include <entt/entt.hpp>
 
 #include "Utilities/Logger.hpp"
 
@@ -33,6 +35,27 @@ struct AppData
 
 };
 
+// Per-frame timing written by Application::run()
+struct FrameTiming
+{
+    sf::Time fixedTimeStep{ sf::seconds(1.0f / 60.0f) };
+    int maxCatchUpSteps{ 5 };
+
+    // How far the frame is between the last two simulation steps (0..1)
+    float interpolationAlpha{ 1.0f };
+    int stepsThisFrame{ 0 };
+    bool droppedTime{ false };   // Catch-up limit was hit and the backlog was discarded
+};
+
+// Identifies the setting that changed in AppSettings::onChanged
+enum class SettingID
+{
+    MusicMuted,
+    SfxMuted,
+    MusicVolume,
+    SfxVolume
+};
+
 struct AppSettings
 {
     // Resolution target settings
@@ -44,17 +67,23 @@ struct AppSettings
     bool sfxMuted{ false };
     float musicVolume{ 100.0f };
     float sfxVolume{ 100.0f };
+
+    // Published by the setters below after a value actually changed.
+    // Connect with entt::sink{ settings.onChanged }.connect<&handler>()
+    entt::sigh<void(SettingID)> onChanged;
     
     void toggleMusicMute()
     {
         musicMuted = !musicMuted;
         logger::Info(std::format("Music muted: {}", musicMuted ? "true" : "false"));
+        onChanged.publish(SettingID::MusicMuted);
     }
     
     void toggleSfxMute()
     {
         sfxMuted = !sfxMuted;
         logger::Info(std::format("SFX muted: {}", sfxMuted ? "true" : "false"));
+        onChanged.publish(SettingID::SfxMuted);
     }
     
     float getMusicVolume() const
@@ -71,17 +100,27 @@ struct AppSettings
     
     void setMusicVolume(float volume, sf::Music& music)
     {
+        const float previous = musicVolume;
         musicVolume = std::clamp(volume, 0.0f, 100.0f);
         music.setVolume(musicVolume);
         
         logger::Info(std::format("Music volume set to: {}", musicVolume));
+        if (musicVolume != previous)
+        {
+            onChanged.publish(SettingID::MusicVolume);
+        }
     }
     
     void setSfxVolume(float volume)
     {
         // SFX volume is stored but not applied to active sounds (cuz they're short-lived)
+        const float previous = sfxVolume;
         sfxVolume = std::clamp(volume, 0.0f, 100.0f);
         
         logger::Info(std::format("SFX volume set to: {}", sfxVolume));
+        if (sfxVolume != previous)
+        {
+            onChanged.publish(SettingID::SfxVolume);
+        }
     }
 };
\ No newline at end of file
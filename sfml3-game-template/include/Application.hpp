@@ -1,10 +1,16 @@
 #pragma once
 
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
 
 #include "AppContext.hpp"
+#include "Managers/TimeManager.hpp"
 #include "Managers/StateManager.hpp"
 
+#include <optional>
+
 class Application
 {
 public:
@@ -17,13 +23,34 @@ public:
 
 private:
     void initMainWindow();
+    void initFramePacing();
     void initResources();
+    void initSimulation();
+    void initLatencyTracking();
 
+    // Connects the window event handlers to the GlobalEventManager bus
+    void connectEvents();
+    // Polls the window and drains the event queues
     void processEvents();
+    // One fixed simulation step. Returns false if it caused a state change.
+    bool step(TimeDomain domain);
     void update(sf::Time deltaTime);
     void render();
+    // Refreshes the latency readout a few times per second
+    void updateLatencyOverlay();
+
+    void onKeyPressed(const sf::Event::KeyPressed& event);
+    void onMouseButtonPressed(const sf::Event::MouseButtonPressed& event);
+    void onResized(const sf::Event::Resized& event);
+    void onMouseMoved(const sf::Event::MouseMoved& event);
+    void onMouseLeft(const sf::Event::MouseLeft& event);
 
     // Resources
     AppContext m_AppContext;
     StateManager m_StateManager;
+
+    // Input latency readout (Action::ToggleLatency)
+    std::optional<sf::Text> m_LatencyText;
+    bool m_ShowLatency{ false };
+    sf::Clock m_LatencyRefreshClock;
 };
\ No newline at end of file
@@ -19,6 +19,10 @@ namespace Assets
         constexpr std::string_view ButtonRightArrow = "ButtonRightArrow";
         constexpr std::string_view ButtonBackground = "ButtonBackground";
     }
+    namespace Animations
+    {
+        constexpr std::string_view Player = "PlayerAnimations";
+    }
     namespace SoundBuffers
     {
     }
@@ -30,5 +34,6 @@ namespace Assets
     {
         constexpr std::string_view Window = "WindowConfig";
         constexpr std::string_view Player = "Player";
+        constexpr std::string_view Input = "InputBindings";
     }
 }
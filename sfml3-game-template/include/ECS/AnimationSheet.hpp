@@ -0,0 +1,81 @@
+// Shared (flyweight) animation clip library for one sprite sheet.
+// Loaded once per sheet by the ResourceManager from a TOML metadata file that sits
+// next to the sheet's image. Frame rects are precomputed at load time so animators
+// only need a clip index, a frame index and a timer.
+
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "ECS/PixelMask.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Index of a clip inside its AnimationSheet. Resolve names to IDs once (at entity
+// creation) with AnimationSheet::findClip(), never per frame.
+using ClipID = std::uint8_t;
+constexpr ClipID InvalidClip = 0xFF;
+
+struct AnimationClip
+{
+    std::uint16_t firstFrame{ 0 };   // Index of this clip's first rect in the sheet's frame list
+    std::uint8_t frameCount{ 0 };
+    float timePerFrame{ 0.0f };      // Seconds
+};
+
+class AnimationSheet
+{
+public:
+    AnimationSheet() = default;
+
+    // Mirrors sf::Texture::loadFromFile() so the ResourceManager can treat it like any resource
+    [[nodiscard]] bool loadFromFile(std::string_view filepath);
+
+    [[nodiscard]] ClipID findClip(std::string_view name) const;
+
+    const AnimationClip& getClip(ClipID clip) const { return m_Clips[clip]; }
+    std::size_t getClipCount() const noexcept { return m_Clips.size(); }
+
+    const sf::IntRect& getFrameRect(std::size_t index) const { return m_FrameRects[index]; }
+    const sf::IntRect& getFrameRect(ClipID clip, std::uint8_t frame) const
+    {
+        return m_FrameRects[m_Clips[clip].firstFrame + frame];
+    }
+    std::size_t getFrameCount() const noexcept { return m_FrameRects.size(); }
+
+    sf::Vector2i getFrameSize() const noexcept { return m_FrameSize; }
+
+    // Texture ID (as in the assets manifest) of the image this sheet describes
+    std::string_view getTextureID() const noexcept { return m_TextureID; }
+
+    //$ --- Pixel masks --- //
+    // Set by 'pixelMasks = true' in the [sheet] table. The ResourceManager then calls
+    // buildPixelMasks() with the sheet's image once, right after loading.
+    bool wantsPixelMasks() const noexcept { return m_WantsPixelMasks; }
+    void buildPixelMasks(const sf::Image& image);
+
+    // nullptr if masks weren't built. 'flipped' returns the mirrored mask for sprites
+    // drawn with a negative x scale.
+    const PixelMask* getPixelMask(std::size_t frameIndex, bool flipped = false) const noexcept
+    {
+        const std::size_t index = frameIndex * 2 + (flipped ? 1 : 0);
+        return index < m_PixelMasks.size() ? &m_PixelMasks[index] : nullptr;
+    }
+
+private:
+    std::vector<AnimationClip> m_Clips;
+    std::vector<std::string> m_ClipNames;   // Parallel to m_Clips
+    std::vector<sf::IntRect> m_FrameRects;
+    sf::Vector2i m_FrameSize{ 0, 0 };
+    std::string m_TextureID;
+
+    bool m_WantsPixelMasks{ false };
+    std::uint8_t m_MaskAlphaThreshold{ 0 };
+    std::vector<PixelMask> m_PixelMasks;    // Two per frame: normal, flipped
+};
@@ -0,0 +1,117 @@
+// Collision detection shared data and narrow-phase tests.
+// CoreSystems::collisionSystem keeps a CollisionWorld in the registry context:
+// bodies sorted along x for sweep-and-prune (re-sorted incrementally every step, which is
+// close to linear because bodies barely move between steps), the contacts found this
+// step, and a signal that delivers them as one batch.
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+enum class ColliderShape : std::uint8_t
+{
+    Box,
+    Circle
+};
+
+namespace CollisionLayers
+{
+    constexpr std::uint32_t Default = 1u << 0;
+    constexpr std::uint32_t Player = 1u << 1;
+    constexpr std::uint32_t Enemy = 1u << 2;
+    constexpr std::uint32_t Projectile = 1u << 3;
+    constexpr std::uint32_t Static = 1u << 4;
+    constexpr std::uint32_t All = 0xFFFFFFFFu;
+}
+
+struct Contact
+{
+    entt::entity a{ entt::null };
+    entt::entity b{ entt::null };
+    sf::Vector2f normal{ 0.0f, 0.0f };  // Unit vector from a towards b
+    float penetration{ 0.0f };          // Overlap depth along the normal (0 for swept hits)
+    float time{ 1.0f };                 // Swept hits: fraction of the step at first touch
+    bool began{ false };                // First step this pair is touching
+};
+
+struct ContactEnd
+{
+    entt::entity a{ entt::null };
+    entt::entity b{ entt::null };
+};
+
+struct CollisionStats
+{
+    std::size_t bodies{ 0 };
+    std::size_t sortSwaps{ 0 };         // Insertion sort work this step (~0 when little moves)
+    std::size_t candidatePairs{ 0 };    // Pairs that passed the broad phase
+    std::size_t sweptTests{ 0 };
+    std::size_t pixelTests{ 0 };        // PixelPerfect mask tests run after a box hit
+    std::size_t contacts{ 0 };
+};
+
+// Registry context: owned and updated by CoreSystems::collisionSystem
+struct CollisionWorld
+{
+    struct Body
+    {
+        entt::entity entity{ entt::null };
+        sf::FloatRect box;                  // Collider box at the end of this step
+        sf::Vector2f displacement;          // Movement since the previous step
+        float minX{ 0.0f };                 // Swept extents (box + displacement), used by
+        float maxX{ 0.0f };                 // the broad phase so fast movers can't skip pairs
+        float minY{ 0.0f };
+        float maxY{ 0.0f };
+        float radius{ 0.0f };               // Circles only
+        ColliderShape shape{ ColliderShape::Box };
+        std::uint32_t layer{ CollisionLayers::Default };
+        std::uint32_t mask{ CollisionLayers::All };
+        bool isStatic{ false };
+        bool seen{ false };                 // Still has an active collider this step
+    };
+
+    std::vector<Body> bodies;                   // Sorted by minX
+    std::vector<entt::entity> members;          // entt::to_entity(entity) -> entity if in 'bodies'
+
+    // This step's batch (also published through onContacts)
+    std::vector<Contact> contacts;
+    std::vector<ContactEnd> ended;
+
+    std::vector<std::uint64_t> pairs;           // Sorted pair keys touching this step
+    std::vector<std::uint64_t> previousPairs;
+
+    CollisionStats stats;
+
+    // Connect with entt::sink{ world.onContacts }.connect<&handler>()
+    entt::sigh<void(std::span<const Contact>)> onContacts;
+};
+
+namespace Collision
+{
+    std::optional<Contact> boxBox(const sf::FloatRect& a, const sf::FloatRect& b);
+    std::optional<Contact> circleCircle(sf::Vector2f centerA, float radiusA,
+                                        sf::Vector2f centerB, float radiusB);
+    // Normal points from the box towards the circle
+    std::optional<Contact> boxCircle(const sf::FloatRect& box, sf::Vector2f center, float radius);
+
+    // Box 'a' moves by 'displacement' (relative to 'b') over the step. Reports the first
+    // touch (time 0..1), so fast movers can't tunnel through thin colliders.
+    // The collision system also uses it for fast box/circle pairs, with the circle's
+    // box: conservative, so a fast circle can report a hit on a box corner it would
+    // just have missed.
+    std::optional<Contact> sweptBoxBox(const sf::FloatRect& a, sf::Vector2f displacement,
+                                       const sf::FloatRect& b);
+
+    // Circle 'a' (at its start position) moves by 'displacement' relative to circle 'b'
+    std::optional<Contact> sweptCircleCircle(sf::Vector2f centerA, float radiusA,
+                                             sf::Vector2f displacement,
+                                             sf::Vector2f centerB, float radiusB);
+}
@@ -6,14 +6,25 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/String.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
 
+#include "AppData.hpp"
+#include "ECS/AnimationSheet.hpp"
+#include "ECS/Collision.hpp"
+#include "ECS/SpatialGrid.hpp"
+#include "Utilities/InlineFunction.hpp"
 #include "Utilities/Utils.hpp"
 
-#include <functional>
-#include <map>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string>
+#include <vector>
+
+class EntityPool; // forward declaration
 
 //$ ----- Game Components ----- //
 
@@ -40,44 +51,101 @@ struct ConfineToWindow
 };
 
 
-// ----- Sprite / Animation Components ----- //
-struct SpriteComponent { sf::Sprite sprite; };
+// ----- Pooling Components ----- //
+// Tag for parked pooled entities -- systems exclude these from their views
+struct Inactive {};
 
-struct Animation
+// Added by EntityPool to every entity it builds
+struct Pooled
 {
-    Animation() = default;
-    Animation(int row, int frames, sf::Time duration)
-        : row(row)
-        , frames(frames)
-        , duration(duration)
-    { }
+    EntityPool* pool{ nullptr };
+    bool parked{ false };
+};
 
-    int row{ 0 };                        // The row on the sprite sheet (0 for idle, 1 for walk, etc.)
-    int frames{ 0 };                     // Total number of frames in this animation
-    sf::Time duration{ sf::Time::Zero }; // Total duration this animation should take
 
-    // Calculates time per frame. sf::Time / float is a valid operation.
-    sf::Time getTimePerFrame() const
+// ----- Sprite / Animation Components ----- //
+struct SpriteComponent { sf::Sprite sprite; };
+
+struct AnimatorComponent
+{
+    // Shared clip library for this entity's sprite sheet (owned by the ResourceManager)
+    const AnimationSheet* sheet{ nullptr };
+    float elapsedTime{ 0.0f };      // Seconds accumulated since the last frame change
+    ClipID clip{ 0 };               // Current clip, e.g. the sheet's "idle" or "walk"
+    std::uint8_t currentFrame{ 0 }; // Frame index within the current clip
+
+    // Switches clips and restarts from frame 0. Does nothing if the clip is already playing,
+    // so it's safe to call every frame.
+    void play(ClipID newClip)
     {
-        return (frames > 0) ? duration / static_cast<float>(frames) : sf::Time::Zero;
+        if (newClip == clip || newClip == InvalidClip)
+        {
+            return;
+        }
+        clip = newClip;
+        currentFrame = 0;
+        elapsedTime = 0.0f;
     }
 };
 
-struct AnimatorComponent
+// Position at the start of the current simulation step. renderSystem draws the sprite
+// at lerp(previousPosition, current, alpha) so motion stays smooth when the fixed
+// simulation rate is lower than the display rate.
+struct RenderInterpolation { sf::Vector2f previousPosition{ 0.0f, 0.0f }; };
+
+// Slot of a quad inside a SpriteBatch (which lives on the 'batch' entity).
+// Batched sprites are drawn by their batch and don't have a SpriteComponent.
+struct BatchedSprite
+{
+    entt::entity batch{ entt::null };
+    std::uint32_t quad{ 0 };
+};
+
+// Clip IDs resolved once at creation, so input handling never compares strings
+struct LocomotionClips
 {
-    // Stores all available animations by name
-    std::map<std::string, Animation> animations;
+    ClipID idle{ InvalidClip };
+    ClipID walk{ InvalidClip };
+};
 
-    std::string currentAnimationName{ "" }; // "idle", "walk", etc.
-    int currentFrame{ 0 };                      // The current frame index (0-9 for idle, etc.)
-    sf::Time elapsedTime{ sf::Time::Zero };     // Time accumulated since the last frame change
-    sf::Vector2i frameSize{ 0, 0 };             // e.g., {32, 32}
+// ----- Update LOD ----- //
+// Entities with this tick every 'interval' frames instead of every frame (set by
+// updateLODSystem from visibility and distance). Systems that honor it skip the entity
+// unless 'ticking' and simulate 'tickDelta' (the time accumulated since its last tick).
+// Both hold for one step: animationSystem resets them once read, so they run between
+// updateLODSystem and animationSystem.
+struct UpdateLOD
+{
+    std::uint8_t interval{ 1 };     // 1 = every frame
+    std::uint8_t phase{ 0 };        // Frame offset so entities with the same interval stagger
+    bool ticking{ true };
+    float accumulated{ 0.0f };      // Seconds since the last tick
+    float tickDelta{ 0.0f };        // Seconds to simulate on this tick
+};
+
+// Registry context: tuning for updateLODSystem (defaults are used if never set)
+struct UpdateLODSettings
+{
+    float nearDistance{ 600.0f };   // Distance from the focus point counted as "near"
+    float viewMargin{ 64.0f };      // Extra border around the view still counted as visible
+    std::uint8_t visibleFarInterval{ 2 };
+    std::uint8_t offscreenNearInterval{ 4 };
+    std::uint8_t offscreenFarInterval{ 8 };
+};
+
+// Registry context: per-frame counters written by updateLODSystem
+struct UpdateLODStats
+{
+    std::size_t ticked{ 0 };
+    std::size_t skipped{ 0 };
 };
 
 enum class FacingDirection { Left, Right };
 
 struct Facing { FacingDirection dir = FacingDirection::Right; };
 
+// Scale the drawable was built with. Flipping toggles its sign; the hierarchy's
+// world scale is multiplied with it instead of replacing it.
 struct BaseScale { sf::Vector2f value{ 1.0f, 1.0f }; };
 
 struct RenderableCircle
@@ -109,6 +177,111 @@ struct RenderableRect
 };
 
 
+// ----- Collision ----- //
+// Collision shape inset from the sprite's global bounds by its transparent padding
+// (the same padding ConfineToWindow uses, already multiplied by the sprite scale).
+// Circles fit inside the inset box unless 'radius' is set.
+// Use EntityFactory::addSpriteCollider() to build one from a sprite.
+struct Collider
+{
+    ColliderShape shape{ ColliderShape::Box };
+    SpritePadding padding;
+    float radius{ 0.0f };
+    std::uint32_t layer{ CollisionLayers::Default };
+    std::uint32_t mask{ CollisionLayers::All };     // Layers this collider reports contacts with
+    bool isStatic{ false };                         // Static pairs are never tested
+};
+
+// Tag: after the collider boxes overlap, also require the sprites' pixels to overlap.
+// Needs an AnimatorComponent whose sheet has pixel masks ('pixelMasks = true');
+// entities without masks are treated as their solid collider box.
+struct PixelPerfect {};
+
+// ----- Navigation ----- //
+// Steered towards 'goal' by CoreSystems::navigationSystem, which writes Velocity from the
+// goal's shared flow field (needs Velocity, MovementSpeed and a SpriteComponent).
+// Agents with the same goal cell share one field.
+struct NavAgent
+{
+    sf::Vector2f goal{ 0.0f, 0.0f };
+    float arriveRadius{ 8.0f };     // Stops within this distance of the goal
+    bool arrived{ false };
+};
+
+// ----- Spatial Index ----- //
+// Indexes the entity in the SpatialGrid (registry context) under the given layers.
+// Entities with UIBounds get one (UI layer) automatically.
+struct SpatialProxy { std::uint32_t layers{ SpatialLayers::World }; };
+
+// ----- Transform Hierarchy Components ----- //
+// Position/scale relative to the Parent (or to the world if there's no parent)
+struct LocalTransform
+{
+    sf::Vector2f position{ 0.0f, 0.0f };
+    sf::Vector2f scale{ 1.0f, 1.0f };
+};
+
+// Written by transformSystem -- don't set this directly, use the Hierarchy helpers
+struct WorldTransform
+{
+    sf::Vector2f position{ 0.0f, 0.0f };
+    sf::Vector2f scale{ 1.0f, 1.0f };
+};
+
+struct Parent { entt::entity entity{ entt::null }; };
+
+struct Children { std::vector<entt::entity> entities; };
+
+// Tag: this entity (and its subtree) needs its WorldTransform recomputed
+struct TransformDirty {};
+
+// ----- Layout ----- //
+// See Layout.hpp. Containers position their Children (Hierarchy links); the layout pass
+// only runs for containers tagged LayoutDirty.
+enum class Anchor : std::uint8_t
+{
+    TopLeft, Top, TopRight,
+    Left, Center, Right,
+    BottomLeft, Bottom, BottomRight
+};
+
+enum class LayoutMode : std::uint8_t
+{
+    Anchored,           // Each child placed by its own LayoutAnchor
+    VerticalStack,
+    HorizontalStack
+};
+
+struct LayoutPadding
+{
+    float left{ 0.0f };
+    float top{ 0.0f };
+    float right{ 0.0f };
+    float bottom{ 0.0f };
+};
+
+struct LayoutContainer
+{
+    LayoutMode mode{ LayoutMode::VerticalStack };
+    Anchor align{ Anchor::Center };         // Where a stack sits in the content area
+    float spacing{ 0.0f };                  // Between stacked children
+    LayoutPadding padding;
+    sf::Vector2f size{ 0.0f, 0.0f };        // 0 = fit the content (roots: fill the view)
+};
+
+// Placement in an Anchored parent (or in the view, for a root container with a size)
+struct LayoutAnchor
+{
+    Anchor anchor{ Anchor::Center };
+    sf::Vector2f offset{ 0.0f, 0.0f };
+};
+
+// Written by the layout pass: measured size and assigned rect
+struct LayoutBox { sf::FloatRect rect; };
+
+// Tag: the container (and its ancestors) must be measured/arranged again
+struct LayoutDirty {};
+
 //$ ----- UI Components -----
 enum class UITags { None, Menu, Settings, Transition, Pause };
 
@@ -119,15 +292,46 @@ struct GUIButtonTag {};
 
 struct UIHover {};
 
+// 0 = normal look, 1 = hovered. Faded by a tween when UIHover comes and goes; entities
+// without it switch colours instantly.
+struct HoverBlend { float value{ 0.0f }; };
+
+// Button labels: recoloured from the parent button's hover state instead of their own
+struct UIHoverFromParent {};
+
 struct UIText { sf::Text text; };
 
+// Writes 'value' into 'buffer' and returns the length; must not allocate
+using TextFormatter = std::size_t (*)(std::span<char> buffer, float value);
+
+// Shows a watched value in the entity's UIText. UISystems::textBindingSystem re-formats
+// it and calls setString (which rebuilds the glyph geometry) only when the value changed.
+struct TextBinding
+{
+    const float* source{ nullptr };             // Must outlive the binding (e.g. an AppSettings field)
+    TextFormatter format{ &utils::formatInteger };
+    float shownValue{ 0.0f };
+    sf::String shownText;                       // Decoded text, its storage reused between changes
+    bool keepCentered{ true };                  // Re-center the origin after each change
+};
+
 struct UIShape { sf::RectangleShape shape; };
 
 struct UIBounds { sf::FloatRect rect; };
 
-struct UIAction { std::function<void()> action; };
+// Click callback, stored inline in the component (no heap allocation, captures up to
+// 32 bytes: 'this' plus a pointer or two)
+using UICallback = utils::InlineFunction<void(), 32>;
+
+struct UIAction { UICallback action; };
 
-struct UIToggleCond { std::function<bool()> shouldShowOverlay; };
+// Red X overlay shown while the condition holds. Re-checked only when 'setting' changes
+// (see UISystems::refreshToggleOverlays).
+struct UIToggleCond
+{
+    SettingID setting;
+    utils::InlineFunction<bool(), 16> shouldShowOverlay;
+};
 
 struct GUISprite { sf::Sprite sprite; };
 
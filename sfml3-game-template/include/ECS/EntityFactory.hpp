@@ -7,31 +7,76 @@
 
 #include "AppContext.hpp"
 #include "Components.hpp"
+#include "ECS/AnimationSheet.hpp"
+#include "ECS/Collision.hpp"
+#include "Managers/EntityPoolManager.hpp"
 
-#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 namespace EntityFactory
 {
     entt::entity createPlayer(AppContext& context, sf::Vector2f position);
 
+    // Collider sized to the sprite's visible pixels. Reads the texture back from the GPU
+    // (utils::getSpritePadding), so call it once at creation, after the sprite is scaled.
+    Collider& addSpriteCollider(entt::registry& registry,
+                                entt::entity entity,
+                                ColliderShape shape = ColliderShape::Box,
+                                std::uint32_t layer = CollisionLayers::Default,
+                                std::uint32_t mask = CollisionLayers::All,
+                                bool isStatic = false);
+
     entt::entity createRectangle(AppContext& context,
                                 sf::Vector2f size,
                                 const sf::Color& color,
                                 sf::Vector2f position);
+
+    //$ --- Batched Sprites --- //
+    // Creates the entity that owns a SpriteBatch (one draw call for all its sprites)
+    entt::entity createSpriteBatch(AppContext& context,
+                                   const sf::Texture& texture,
+                                   std::size_t reserveQuads = 0);
+
+    // Animated quad drawn by batchEntity. Position is the quad's center.
+    // updateLOD adds an UpdateLOD component; only ask for it if updateLODSystem runs.
+    entt::entity createBatchedSprite(AppContext& context,
+                                     entt::entity batchEntity,
+                                     const AnimationSheet& sheet,
+                                     ClipID clip,
+                                     sf::Vector2f position,
+                                     float scale = 1.0f,
+                                     bool updateLOD = false);
+
+    //$ --- Pooled Entities --- //
+    // The builder runs once per pooled entity; acquire/release only toggle the Inactive tag
+    EntityPool& createPool(AppContext& context,
+                           std::string_view poolID,
+                           EntityPool::Builder builder,
+                           std::size_t prewarmCount = 0);
+
+    // Returns entt::null if the pool doesn't exist. Moves the entity's sprite/shape to position.
+    entt::entity acquirePooled(AppContext& context,
+                               std::string_view poolID,
+                               sf::Vector2f position);
+
+    // Use this instead of registry.destroy() for pooled entities
+    void releasePooled(AppContext& context, entt::entity entity);
     
     //$ --- G/UI Entities --- //
     entt::entity createButton(AppContext& context,
                             sf::Font& font,
                             const std::string& text,
                             sf::Vector2f position,
-                            std::function<void()> action,
+                            UICallback action,
                             UITags tag = UITags::Menu,
                             sf::Vector2f size = {250.0f, 100.0f});
 
     entt::entity createGUIButton(AppContext& context,
                                 sf::Texture& texture,
                                 sf::Vector2f position,
-                                std::function<void()> action,
+                                UICallback action,
                                 UITags tag = UITags::Menu);
 
     entt::entity createButtonLabel(AppContext& context,
@@ -44,10 +89,28 @@ namespace EntityFactory
     entt::entity createLabeledButton(AppContext& context, 
                                     sf::Texture& texture,
                                     sf::Vector2f position,
-                                    std::function<void()> action,
+                                    UICallback action,
                                     sf::Font& font,
                                     UITags tag = UITags::Menu,
                                     const std::string& text = "",
                                     unsigned int size = 32,
                                     const sf::Color& color = sf::Color::White);
+
+    // Layout container (see Layout.hpp), transformable so children can follow it. With a
+    // 'parent' container it's added to it, otherwise it's a root that fills the view.
+    entt::entity createLayout(AppContext& context,
+                              const LayoutContainer& layout,
+                              UITags tag = UITags::Menu,
+                              entt::entity parent = entt::null,
+                              LayoutAnchor anchor = {});
+
+    // Centered text showing 'source' (see TextBinding); 'source' must outlive the entity
+    entt::entity createBoundText(AppContext& context,
+                                 sf::Font& font,
+                                 const float& source,
+                                 sf::Vector2f position,
+                                 UITags tag = UITags::Menu,
+                                 unsigned int size = 48,
+                                 const sf::Color& color = sf::Color::White,
+                                 TextFormatter format = &utils::formatInteger);
 }
\ No newline at end of file
@@ -0,0 +1,28 @@
+// Helpers for the parent/child transform hierarchy.
+// These keep Parent/Children links consistent and mark subtrees dirty so that
+// CoreSystems::transformSystem only recomputes what actually changed.
+
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+namespace Hierarchy
+{
+    // Gives the entity a LocalTransform/WorldTransform pair (no-op if it already has one)
+    void makeTransformable(entt::registry& registry, entt::entity entity,
+                           sf::Vector2f position, sf::Vector2f scale = { 1.0f, 1.0f });
+
+    // Child follows parent from now on; localPosition is relative to the parent's world position.
+    // The parent must already be transformable.
+    void attach(entt::registry& registry, entt::entity child, entt::entity parent,
+                sf::Vector2f localPosition);
+
+    // Child becomes a root again and keeps its current world position
+    void detach(entt::registry& registry, entt::entity child);
+
+    void setLocalPosition(entt::registry& registry, entt::entity entity, sf::Vector2f position);
+    void setLocalScale(entt::registry& registry, entt::entity entity, sf::Vector2f scale);
+
+    void markDirty(entt::registry& registry, entt::entity entity);
+}
@@ -0,0 +1,51 @@
+// Event-driven hover state for UI entities. Application forwards pointer moves from the
+// event bus (only the last MouseMoved of a frame matters, earlier ones are overwritten), and
+// UISystems::uiHoverSystem() hit-tests the pointer against the SpatialGrid only when
+// something changed since the last test: the pointer moved or left the window, the view
+// was resized, or a UI entity was added, moved, removed or (de)activated. UIHover is only
+// added/removed on enter/leave, so a menu nobody touches does no UI work per frame.
+
+#pragma once
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include <optional>
+#include <span>
+#include <vector>
+
+// Registry context, created by HoverTracking::connect()
+class HoverTracker
+{
+public:
+    // Pointer position in window pixels
+    void pointerMoved(sf::Vector2i pixel) noexcept;
+    void pointerLeft() noexcept;
+
+    // Forces a new hit test (view change, UI added/moved/removed under a still pointer)
+    void invalidate() noexcept { m_Dirty = true; }
+    bool isDirty() const noexcept { return m_Dirty; }
+
+    // Hit-tests the pointer and adds/removes UIHover on the entities it entered/left.
+    // Does nothing if nothing changed since the last call.
+    void update(entt::registry& registry, const sf::RenderWindow& window);
+
+    std::span<const entt::entity> getHovered() const noexcept { return m_Hovered; }
+
+private:
+    std::optional<sf::Vector2i> m_Pointer;      // nullopt until the first move is known
+    bool m_PointerInside{ true };
+    bool m_Dirty{ true };
+
+    std::vector<entt::entity> m_Hovered;
+    std::vector<entt::entity> m_Hits;           // Reused by update()
+};
+
+namespace HoverTracking
+{
+    // Creates the tracker in the registry context and connects the signals that
+    // invalidate it (UIBounds and Inactive changes)
+    void connect(entt::registry& registry);
+    void disconnect(entt::registry& registry);
+}
@@ -0,0 +1,41 @@
+// Incremental UI layout on top of the transform hierarchy. A LayoutContainer positions its
+// Children: as a vertical/horizontal stack, or each by its LayoutAnchor. Containers nest,
+// and root containers fill the view. UISystems::layoutSystem measures (bottom-up) and
+// arranges (top-down) only containers tagged LayoutDirty, and only moves the elements whose
+// position actually changed. Moves go through Hierarchy::setLocalPosition, so
+// transformSystem syncs drawables and UIBounds as usual.
+//
+// Containers are flagged dirty automatically when children are attached/detached or
+// (de)activated, when a child's UIBounds changes size, and on window resize
+// (Application::onResized). Call Layout::markDirty() after other content changes.
+//
+//     auto column = EntityFactory::createLayout(context, { .spacing = 20.0f }, UITags::Menu);
+//     Layout::add(registry, column, playButton);
+//     Layout::add(registry, column, settingsButton);
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+
+namespace Layout
+{
+    // Makes 'child' the last child of 'container' (re-parenting it if needed)
+    void add(entt::registry& registry, entt::entity container, entt::entity child,
+             LayoutAnchor anchor = {});
+
+    // Flags the nearest container at or above 'entity', and its ancestors, for a new pass
+    void markDirty(entt::registry& registry, entt::entity entity);
+
+    // Flags every root container (the view changed)
+    void invalidateRoots(entt::registry& registry);
+
+    // Measures and arranges the dirty containers; roots are laid out in 'viewArea'
+    void update(entt::registry& registry, sf::FloatRect viewArea);
+
+    // Connects the signals that flag containers dirty
+    void connect(entt::registry& registry);
+    void disconnect(entt::registry& registry);
+}
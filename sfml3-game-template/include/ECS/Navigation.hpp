@@ -0,0 +1,129 @@
+// Grid navigation for many agents that share goals.
+// A NavGrid (registry context) stores a traversal cost per cell, built from static
+// colliders and/or tilemap data. For every goal cell in use, a flow field is computed
+// once on a worker thread (Dijkstra from the goal outwards) and cached until the grid
+// changes. CoreSystems::navigationSystem then steers each NavAgent by reading one cell of
+// its goal's field, so a crowd heading to the same place costs one field, not one path
+// per agent.
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace NavCost
+{
+    constexpr std::uint8_t Open = 1;
+    constexpr std::uint8_t Blocked = 255;   // Never entered; anything between is weighted
+}
+
+// Costs are copy-on-write: worker threads hold a shared snapshot while the main thread
+// keeps editing its own copy, so a field job never sees a half-updated grid.
+class NavGrid
+{
+public:
+    NavGrid(sf::FloatRect worldBounds = { { 0.0f, 0.0f }, { 1280.0f, 720.0f } },
+            float cellSize = 32.0f);
+
+    // Rebuilds the cell array with every cell open
+    void reset(sf::FloatRect worldBounds, float cellSize);
+
+    // Each of these only bumps the version if a cell actually changed
+    void setCost(sf::Vector2i cell, std::uint8_t cost);
+    void fillRect(sf::FloatRect worldRect, std::uint8_t cost);
+    // Tilemap data: one cost per cell, row-major, getSize().x * getSize().y entries
+    bool setCosts(std::span<const std::uint8_t> costs);
+
+    // Batch rebuild: start from an all-open grid, block rects, then commit. The version
+    // only changes if the result differs from the current costs.
+    void beginRebuild();
+    void rebuildBlockRect(sf::FloatRect worldRect);
+    void commitRebuild();
+
+    std::uint8_t getCost(sf::Vector2i cell) const noexcept;
+    bool isBlocked(sf::Vector2i cell) const noexcept { return getCost(cell) == NavCost::Blocked; }
+
+    // Positions outside the world are clamped into the border cells
+    sf::Vector2i worldToCell(sf::Vector2f position) const noexcept;
+    sf::Vector2f cellCenter(sf::Vector2i cell) const noexcept;
+    int cellIndex(sf::Vector2i cell) const noexcept { return cell.y * m_Size.x + cell.x; }
+    bool inBounds(sf::Vector2i cell) const noexcept;
+
+    sf::Vector2i getSize() const noexcept { return m_Size; }
+    float getCellSize() const noexcept { return m_CellSize; }
+    std::uint64_t getVersion() const noexcept { return m_Version; }
+
+    std::shared_ptr<const std::vector<std::uint8_t>> getSnapshot() const { return m_Costs; }
+
+private:
+    bool overlapsWorld(sf::FloatRect worldRect) const noexcept;
+    // Clones the cost array if a worker still reads the current one
+    std::vector<std::uint8_t>& editCosts();
+
+    sf::Vector2f m_Origin;
+    sf::Vector2i m_Size;
+    float m_CellSize{ 32.0f };
+    std::uint64_t m_Version{ 0 };
+    std::shared_ptr<std::vector<std::uint8_t>> m_Costs;
+    std::vector<std::uint8_t> m_Scratch;    // Batch rebuild target, swapped in on commit
+};
+
+struct FlowField
+{
+    sf::Vector2i size;
+    sf::Vector2i goal;
+    std::uint64_t gridVersion{ 0 };
+    std::vector<sf::Vector2f> directions;   // Unit step towards the goal, zero at the goal
+    std::vector<float> distance;            // Path cost to the goal, < 0 if unreachable
+
+    bool reachable(int index) const noexcept { return distance[index] >= 0.0f; }
+};
+
+struct NavigationStats
+{
+    std::size_t agents{ 0 };
+    std::size_t cachedFields{ 0 };
+    std::size_t pendingFields{ 0 };
+    std::size_t fieldsBuilt{ 0 };       // Jobs that finished this step
+};
+
+// Registry context: owned and updated by CoreSystems::navigationSystem
+struct NavigationCache
+{
+    struct Entry
+    {
+        std::shared_ptr<const FlowField> field;             // Possibly stale while rebuilding
+        std::future<std::shared_ptr<const FlowField>> pending;
+        std::uint64_t pendingVersion{ 0 };
+        std::uint32_t lastUsedStep{ 0 };
+    };
+
+    std::unordered_map<int, Entry> fields;      // Keyed by goal cell index
+    std::uint32_t step{ 0 };
+    NavigationStats stats;
+};
+
+namespace Navigation
+{
+    // Creates (or replaces) the NavGrid in the registry context
+    NavGrid& createGrid(entt::registry& registry, sf::FloatRect worldBounds, float cellSize);
+
+    // Clears the grid and blocks every cell under a static Collider, using the boxes the
+    // collision system computed in its last step. Cheap enough to call every step: the grid
+    // version (and with it every cached field) only changes when the blocked cells do.
+    void rebuildFromColliders(entt::registry& registry);
+
+    // Runs on a worker thread. 8-way moves, diagonals can't cut blocked corners.
+    std::shared_ptr<const FlowField> buildFlowField(
+        std::shared_ptr<const std::vector<std::uint8_t>> costs,
+        sf::Vector2i size, sf::Vector2i goal, std::uint64_t gridVersion);
+}
@@ -0,0 +1,60 @@
+// Packed 1-bit alpha masks for pixel-perfect collision.
+// Built once at load time (the same alpha scan utils::getSpritePadding does, kept as bits)
+// so a test only ANDs 64 pixels per word over the rows where two sprites overlap.
+// Bit x of a row is column x (least significant bit first).
+
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class PixelMask
+{
+public:
+    PixelMask() = default;
+
+    // Pixels with alpha above 'alphaThreshold' are solid. flipX builds the mirrored mask
+    // (what a sprite with a negative x scale shows).
+    void build(const sf::Image& image, const sf::IntRect& rect,
+               std::uint8_t alphaThreshold = 0, bool flipX = false);
+
+    bool isSolid(int x, int y) const noexcept;
+
+    // 64 pixels of row y starting at column x (columns past the row end read as empty)
+    std::uint64_t extract(int y, int x) const noexcept;
+
+    // True if any pixel inside rect (mask coordinates, clamped to the mask) is solid
+    bool anyInRect(sf::IntRect rect) const noexcept;
+
+    sf::Vector2i getSize() const noexcept { return { m_Width, m_Height }; }
+    bool empty() const noexcept { return m_Bits.empty(); }
+
+private:
+    int m_Width{ 0 };
+    int m_Height{ 0 };
+    int m_WordsPerRow{ 0 };
+    std::vector<std::uint64_t> m_Bits;
+};
+
+namespace PixelCollision
+{
+    // A mask placed in the world: 'bounds' is the sprite's global bounds (the whole frame).
+    // Flipped sprites must use their sheet's flipped mask.
+    struct Placement
+    {
+        const PixelMask* mask{ nullptr };
+        sf::FloatRect bounds;
+    };
+
+    // Equal pixel sizes use the word-wide path (SSE2 when available); different scales
+    // fall back to sampling the other mask at the solid pixels of the finer one
+    bool overlap(const Placement& a, const Placement& b);
+
+    // Mask against a solid rectangle (e.g. a plain collider box)
+    bool overlapRect(const Placement& a, const sf::FloatRect& rect);
+}
@@ -0,0 +1,118 @@
+// Uniform-grid spatial index for "what is near / under this point" queries.
+// The grid lives in the registry context and is kept up to date incrementally:
+// UIBounds changes arrive through EnTT signals, sprites are refreshed by
+// CoreSystems::spatialIndexSystem and only touch the cells they actually leave or enter.
+// Queries return spans into a buffer owned by the grid, so they never allocate once the
+// buffer has grown. A span is only valid until the next query.
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace SpatialLayers
+{
+    constexpr std::uint32_t UI = 1u << 0;
+    constexpr std::uint32_t World = 1u << 1;
+    constexpr std::uint32_t All = 0xFFFFFFFFu;
+}
+
+class SpatialGrid
+{
+public:
+    // Positions outside 'worldBounds' are clamped into the border cells, so everything is
+    // still found, just less efficiently
+    SpatialGrid(sf::FloatRect worldBounds = { { 0.0f, 0.0f }, { 1280.0f, 720.0f } },
+                float cellSize = 64.0f);
+
+    // Drops every entry and rebuilds the cell array
+    void reset(sf::FloatRect worldBounds, float cellSize);
+
+    // Inserts the entity, or moves it if it's already indexed (layers are only set on insert)
+    void update(entt::entity entity, sf::FloatRect bounds,
+                std::uint32_t layers = SpatialLayers::World);
+    void remove(entt::entity entity);
+
+    bool contains(entt::entity entity) const noexcept;
+    std::size_t size() const noexcept { return m_Size; }
+
+    // All queries filter by layer mask and test the exact bounds, not just the cells
+    std::span<const entt::entity> queryRect(sf::FloatRect rect,
+                                            std::uint32_t layers = SpatialLayers::All);
+    std::span<const entt::entity> queryRadius(sf::Vector2f center, float radius,
+                                              std::uint32_t layers = SpatialLayers::All);
+    std::span<const entt::entity> queryPoint(sf::Vector2f point,
+                                             std::uint32_t layers = SpatialLayers::All);
+
+    // Entities whose bounds the ray crosses within maxDistance, nearest first.
+    // 'direction' doesn't need to be normalized.
+    std::span<const entt::entity> queryRay(sf::Vector2f origin, sf::Vector2f direction,
+                                           float maxDistance,
+                                           std::uint32_t layers = SpatialLayers::All);
+
+private:
+    struct CellRange
+    {
+        int minX{ 0 };
+        int minY{ 0 };
+        int maxX{ -1 };
+        int maxY{ -1 };
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    struct Entry
+    {
+        entt::entity entity{ entt::null };
+        sf::FloatRect bounds;
+        CellRange cells;
+        std::uint32_t layers{ 0 };
+        std::uint32_t stamp{ 0 };   // Last query that reported this entry (deduplication)
+    };
+
+    int cellX(float x) const noexcept;
+    int cellY(float y) const noexcept;
+    CellRange cellRange(sf::FloatRect bounds) const noexcept;
+    std::vector<entt::entity>& cell(int x, int y) { return m_Cells[y * m_Columns + x]; }
+
+    void addToCells(entt::entity entity, const CellRange& range);
+    void removeFromCells(entt::entity entity, const CellRange& range);
+
+    Entry* findEntry(entt::entity entity) noexcept;
+    const Entry* findEntry(entt::entity entity) const noexcept;
+
+    // Starts a new query; entries already stamped with the returned value are skipped
+    std::uint32_t nextStamp();
+
+    sf::FloatRect m_WorldBounds;
+    float m_CellSize{ 64.0f };
+    float m_InvCellSize{ 1.0f / 64.0f };
+    int m_Columns{ 0 };
+    int m_Rows{ 0 };
+
+    std::vector<std::vector<entt::entity>> m_Cells;
+    std::vector<Entry> m_Entries;      // Indexed by entt::to_entity(entity)
+    std::size_t m_Size{ 0 };
+
+    std::uint32_t m_Stamp{ 0 };
+    std::vector<entt::entity> m_Results;
+    std::vector<std::pair<float, entt::entity>> m_RayHits;
+};
+
+namespace SpatialIndex
+{
+    // Creates the grid in the registry context and connects the signals that keep it
+    // in sync (proxy add/remove, UIBounds changes, pooled entities being parked and reused)
+    void connect(entt::registry& registry, sf::FloatRect worldBounds, float cellSize = 64.0f);
+    void disconnect(entt::registry& registry);
+
+    // Re-reads the entity's bounds (UIBounds, then SpriteComponent) into the grid
+    void refresh(entt::registry& registry, entt::entity entity);
+}
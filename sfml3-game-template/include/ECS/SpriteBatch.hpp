@@ -0,0 +1,60 @@
+// Draws many textured quads that share one texture in a single draw call.
+// A SpriteBatch lives on its own entity (as a component); each batched sprite entity
+// holds a BatchedSprite slot into it. The animation kernel writes frame UVs straight
+// into the batch's vertices, so batched sprites never go through sf::Sprite.
+
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class SpriteBatch
+{
+public:
+    explicit SpriteBatch(const sf::Texture& texture);
+
+    // Returns the quad slot. Freed slots are reused before the vertex array grows.
+    std::uint32_t addQuad(sf::FloatRect bounds, const sf::IntRect& textureRect);
+
+    // Collapses the quad so it draws nothing and marks the slot for reuse
+    void removeQuad(std::uint32_t quad);
+
+    void setQuadBounds(std::uint32_t quad, sf::FloatRect bounds);
+
+    // Hidden quads keep their slot and bounds but are drawn fully transparent
+    void setQuadHidden(std::uint32_t quad, bool hidden);
+    sf::Vector2f getQuadCenter(std::uint32_t quad) const;
+
+    // Writes the 6 texture coordinates of the quad (used by the animation kernel)
+    void setTextureRect(std::uint32_t quad, const sf::IntRect& textureRect);
+
+    void reserve(std::size_t quadCount);
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) const;
+
+    std::size_t getQuadCount() const noexcept { return m_Vertices.size() / VerticesPerQuad; }
+    std::size_t getActiveQuadCount() const noexcept { return getQuadCount() - m_FreeQuads.size(); }
+
+private:
+    static constexpr std::size_t VerticesPerQuad = 6; // Two triangles
+
+    const sf::Texture* m_Texture{ nullptr };
+    std::vector<sf::Vertex> m_Vertices;
+    std::vector<std::uint32_t> m_FreeQuads;
+};
+
+namespace SpriteBatches
+{
+    // Frees the quad of a destroyed BatchedSprite and hides the quads of parked (Inactive) ones
+    void connect(entt::registry& registry);
+    void disconnect(entt::registry& registry);
+}
@@ -1,12 +1,21 @@
 #pragma once
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/Window/Event.hpp>
 #include <entt/entt.hpp>
 
+#include "AppData.hpp"
+#include "Managers/TimeManager.hpp"
+
+#include <optional>
+
 struct AppContext; // forward declaration
 
+namespace utils { class ThreadPool; }
+
 namespace CoreSystems
 {
     //$ ----- Game Systems ----- //
@@ -16,8 +25,42 @@ namespace CoreSystems
 
     void facingSystem(entt::registry& registry);
 
-    void renderSystem(entt::registry& registry, sf::RenderWindow& window, bool showDebug);
+    // Writes NavAgent velocities from cached flow fields (run before movement). Missing or
+    // outdated fields are queued on 'pool'; until one arrives agents keep following the
+    // stale field, or wait if there is none yet.
+    void navigationSystem(entt::registry& registry, utils::ThreadPool& pool);
+
+    // Recomputes WorldTransform for dirty subtrees only and syncs UI drawables/UIBounds
+    void transformSystem(entt::registry& registry);
+
+    // Sweep-and-prune broad phase + shape tests for Collider entities. Contacts (and pairs
+    // that stopped touching) are written to the CollisionWorld in the registry context
+    // and published as one batch per step. Run after movement.
+    void collisionSystem(entt::registry& registry);
+
+    // Moves sprite SpatialProxy entities in the SpatialGrid (run after movement)
+    void spatialIndexSystem(entt::registry& registry);
 
+    // Run once before every fixed simulation step: snapshots RenderInterpolation positions
+    void storePreviousPositions(entt::registry& registry);
+
+    // 'interpolationAlpha' blends RenderInterpolation sprites between their previous and
+    // current step positions (1.0 draws them exactly where the simulation left them)
+    void renderSystem(entt::registry& registry, sf::RenderWindow& window, bool showDebug,
+                      float interpolationAlpha = 1.0f);
+
+    // Advances the TweenWorld's tweens of 'domain' (batched per easing curve) and writes the
+    // values back into their components. Each state passes its own getTimeDomain(), so
+    // the tweens of the states below it stay frozen.
+    void tweenSystem(entt::registry& registry, sf::Time deltaTime, TimeDomain domain);
+
+    // Decides which UpdateLOD entities tick this frame. Visible entities near 'focus' tick
+    // every frame; far or offscreen ones tick less often with their time accumulated.
+    void updateLODSystem(entt::registry& registry, sf::Time deltaTime,
+                         const sf::View& camera, sf::Vector2f focus);
+
+    // Advances all animators in one pass (catching up multiple frames after long updates),
+    // then writes changed frames to SpriteComponent rects or SpriteBatch UVs
     void animationSystem(entt::registry& registry, sf::Time deltaTime);
 }
 
@@ -29,7 +72,18 @@ namespace UISystems
 
     void uiClickSystem(entt::registry& registry, const sf::Event::MouseButtonPressed& event);
 
+    // Updates UIHover from the HoverTracker; free when neither the pointer nor the UI changed
     void uiHoverSystem(entt::registry& registry, sf::RenderWindow& window);
     
-    void uiSettingsChecks(AppContext& context);
+    // Measures/arranges dirty LayoutContainers (see Layout.hpp); roots fill 'view'.
+    // Run it before transformSystem.
+    void layoutSystem(entt::registry& registry, const sf::View& view);
+
+    // Refreshes UIText of TextBinding entities whose watched value changed
+    void textBindingSystem(entt::registry& registry);
+
+    // Adds/removes the GUIRedX copy of 'overlay' on UIToggleCond buttons watching 'changed'
+    // (all of them if nullopt). Called from AppSettings::onChanged, not every frame.
+    void refreshToggleOverlays(entt::registry& registry, const sf::Sprite& overlay,
+                               std::optional<SettingID> changed = std::nullopt);
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Batched tweening of component fields (sprite position/scale/colour, UI colours, hover blend).
+// Active tweens live in a TweenWorld in the registry context as structure-of-arrays, one
+// batch per time domain and easing curve. Each step CoreSystems::tweenSystem advances the
+// batches of the running state's domain with straight loops over contiguous floats (SSE2
+// for the time step and the interpolation, branch-free curves the compiler can vectorise),
+// then writes the results back through typed accessors. World tweens therefore stop while
+// a UI state is on top, like world timers and tasks. Starting a tween on a field that is
+// already tweening replaces it.
+
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "Managers/TimeManager.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+enum class TweenProperty : std::uint8_t
+{
+    SpritePosition,     // SpriteComponent (x, y)
+    SpriteScale,        // SpriteComponent (x, y)
+    SpriteColor,        // SpriteComponent (r, g, b, a)
+    ShapeFillColor,     // UIShape (r, g, b, a)
+    TextFillColor,      // UIText (r, g, b, a)
+    LocalPosition,      // LocalTransform through Hierarchy::setLocalPosition (x, y)
+    HoverBlend          // HoverBlend (value)
+};
+
+enum class Easing : std::uint8_t
+{
+    Linear,
+    QuadIn,
+    QuadOut,
+    QuadInOut,
+    CubicIn,
+    CubicOut,
+    CubicInOut,
+    BackOut,            // Overshoots slightly, then settles
+    SmoothStep,
+    Count
+};
+
+// Up to four channels; unused channels are ignored by the property's accessor
+struct TweenValue
+{
+    std::array<float, 4> channels{};
+
+    static TweenValue from(float value) { return { { value, 0.0f, 0.0f, 0.0f } }; }
+    static TweenValue from(sf::Vector2f value) { return { { value.x, value.y, 0.0f, 0.0f } }; }
+    static TweenValue from(sf::Color color)
+    {
+        return { { static_cast<float>(color.r), static_cast<float>(color.g),
+                   static_cast<float>(color.b), static_cast<float>(color.a) } };
+    }
+};
+
+struct TweenStats
+{
+    std::size_t active{ 0 };
+    std::size_t finished{ 0 };      // Tweens that reached their end value this frame
+};
+
+// Registry context: filled by the Tweens:: helpers, run by CoreSystems::tweenSystem
+class TweenWorld
+{
+public:
+    void add(entt::entity entity, TweenProperty property, const TweenValue& start,
+             const TweenValue& end, sf::Time duration, Easing easing,
+             TimeDomain domain = TimeDomain::World);
+    bool remove(entt::entity entity, TweenProperty property);
+
+    // Advances the tweens of 'domain' by 'deltaTime' and computes their current values
+    void advance(sf::Time deltaTime, TimeDomain domain);
+
+    // Writes the current values of the tweens of 'domain' into the components, then drops
+    // the finished ones and those whose entity or component is gone
+    void apply(entt::registry& registry, TimeDomain domain);
+
+    std::size_t size() const noexcept { return m_Locations.size(); }
+    // Of the last apply()
+    const TweenStats& getStats() const noexcept { return m_Stats; }
+
+private:
+    static constexpr std::size_t EasingCount = static_cast<std::size_t>(Easing::Count);
+    static constexpr std::size_t DomainCount = static_cast<std::size_t>(TimeDomain::Count);
+
+    struct Batch
+    {
+        std::vector<entt::entity> entities;
+        std::vector<TweenProperty> properties;
+        std::vector<float> elapsed;
+        std::vector<float> invDuration;
+        std::vector<float> progress;                    // Eased 0..1 (BackOut can exceed 1)
+        std::array<std::vector<float>, 4> start;
+        std::array<std::vector<float>, 4> delta;
+        std::array<std::vector<float>, 4> value;        // Output of advance()
+
+        std::size_t size() const noexcept { return entities.size(); }
+        bool isFinished(std::size_t index) const noexcept { return elapsed[index] * invDuration[index] >= 1.0f; }
+    };
+
+    struct Location
+    {
+        std::uint8_t batch{ 0 };
+        std::uint32_t index{ 0 };
+    };
+
+    static std::uint64_t key(entt::entity entity, TweenProperty property) noexcept
+    {
+        return (static_cast<std::uint64_t>(entt::to_integral(entity)) << 8)
+             | static_cast<std::uint64_t>(property);
+    }
+
+    void removeAt(std::size_t batch, std::size_t index);
+
+    // Batches [domain * EasingCount, (domain + 1) * EasingCount) belong to one domain
+    std::array<Batch, DomainCount * EasingCount> m_Batches;
+    std::unordered_map<std::uint64_t, Location> m_Locations;
+    std::vector<Location> m_Done;       // Reused by apply()
+    TweenStats m_Stats;
+};
+
+namespace Tweens
+{
+    // Starts from the field's current value. Does nothing if the entity lacks the component.
+    // The tween runs in the steps of 'domain' (UI for menus, World for gameplay entities).
+    void to(entt::registry& registry, entt::entity entity, TweenProperty property,
+            const TweenValue& target, sf::Time duration, Easing easing = Easing::QuadOut,
+            TimeDomain domain = TimeDomain::World);
+
+    void stop(entt::registry& registry, entt::entity entity, TweenProperty property);
+
+    // Fades HoverBlend in/out (UI domain) when UIHover is added to or removed from an entity
+    void connect(entt::registry& registry);
+    void disconnect(entt::registry& registry);
+}
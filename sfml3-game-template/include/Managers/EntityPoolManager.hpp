@@ -0,0 +1,93 @@
+// Entity pooling for high-churn transient entities (bullets, pickups, hit effects, etc.)
+// Released entities are parked with the Inactive tag instead of being destroyed, so their
+// components (and the sf::Sprite inside SpriteComponent) stay allocated for reuse.
+
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct PoolStats
+{
+    std::size_t created{ 0 };       // Entities built by the pool's builder
+    std::size_t active{ 0 };        // Entities currently handed out
+    std::size_t parked{ 0 };        // Entities waiting in the pool (Inactive)
+    std::size_t peakActive{ 0 };    // Highest 'active' count seen
+    std::size_t acquires{ 0 };      // Total acquire() calls
+    std::size_t recycled{ 0 };      // acquire() calls served by a parked entity
+};
+
+class EntityPool
+{
+public:
+    // Attaches the full component set to a freshly created entity.
+    // Only called when the pool has no parked entity to hand out.
+    using Builder = std::function<void(entt::registry&, entt::entity)>;
+
+    EntityPool(entt::registry& registry, std::string_view id, Builder builder);
+    EntityPool(const EntityPool&) = delete;
+    EntityPool& operator=(const EntityPool&) = delete;
+    ~EntityPool() = default;
+
+    // Returns an active entity (recycled if possible) or entt::null if the builder is missing
+    [[nodiscard]] entt::entity acquire();
+
+    // Parks the entity; returns false if it doesn't belong to this pool or is already parked
+    bool release(entt::entity entity);
+
+    // Builds 'count' parked entities up front so the first acquires don't allocate
+    void prewarm(std::size_t count);
+
+    // Destroys every entity owned by this pool (active and parked)
+    void clear();
+
+    std::string_view getID() const noexcept { return m_ID; }
+    const PoolStats& getStats() const noexcept { return m_Stats; }
+
+private:
+    friend class EntityPoolManager;
+
+    entt::entity build();
+    void onDestroyed(entt::entity entity, bool wasParked);
+
+    entt::registry& m_Registry;
+    std::string m_ID;
+    Builder m_Builder;
+    std::vector<entt::entity> m_Parked;
+    PoolStats m_Stats;
+};
+
+class EntityPoolManager
+{
+public:
+    explicit EntityPoolManager(entt::registry& registry);
+    EntityPoolManager(const EntityPoolManager&) = delete;
+    EntityPoolManager& operator=(const EntityPoolManager&) = delete;
+    ~EntityPoolManager();
+
+    // Creating a pool with an existing ID replaces (and clears) the old pool
+    EntityPool& createPool(std::string_view id, EntityPool::Builder builder,
+                           std::size_t prewarmCount = 0);
+
+    [[nodiscard]] EntityPool* getPool(std::string_view id);
+    [[nodiscard]] const EntityPool* getPool(std::string_view id) const;
+
+    void destroyPool(std::string_view id);
+
+    void logStats() const;
+
+private:
+    // Keeps pool bookkeeping correct when a pooled entity is destroyed directly
+    // (e.g. by a state's cleanup) instead of being released.
+    void onPooledDestroyed(entt::registry& registry, entt::entity entity);
+
+    entt::registry& m_Registry;
+    std::map<std::string, std::unique_ptr<EntityPool>, std::less<>> m_Pools;
+};
@@ -1,32 +1,74 @@
-// This handles global input events for the application
-// real-time input handling (real-time polling) is managed separately
+// Typed event bus for the application (built on entt::dispatcher).
+// Anything holding the AppContext can enqueue events of any type. Each event type has its
+// own contiguous queue, and queued events are delivered in one batch per type when the
+// queues are drained, at fixed points of the frame:
+//   1. Application::processEvents(), right after the window events were delivered
+//   2. Application::run(), after the frame's fixed simulation steps (events raised by systems)
+// Events enqueued while a batch is being delivered wait for the next drain.
+// trigger() delivers an event immediately instead, bypassing the queue.
+//
+// Window events enter the bus through pollWindowEvents(), which delivers them immediately
+// and in the order they were polled (not through the per-type queues, which would reorder
+// a key press and its release); listeners connect to the SFML event types directly.
+// For held keys, query InputManager (isDown/wasPressed) instead of handling key events.
+//
+//     bus.sink<sf::Event::KeyPressed>().connect<&MySystem::onKeyPressed>(mySystem);
+//     bus.enqueue(ScoreChanged{ 10 });
+//     ...
+//     bus.disconnect(mySystem);
 
 #pragma once
 
 #include <SFML/Window/Event.hpp>
+#include <SFML/Window/Window.hpp>
+#include <entt/signal/dispatcher.hpp>
 
-#include <functional>
+#include <utility>
 
 struct AppContext; // forward-declaration
 
-struct ApplicationEvents
-{
-	std::function<void(const sf::Event::Closed&)> onClose;
-    std::function<void(const sf::Event::KeyPressed&)> onGlobalKeyPress;
-
-};
-
 class GlobalEventManager
 {
 public:
     explicit GlobalEventManager(AppContext* appContext);
     GlobalEventManager(const GlobalEventManager&) = delete;
     GlobalEventManager& operator=(const GlobalEventManager&) = delete;
-    ~GlobalEventManager() = default;
+    ~GlobalEventManager();
+
+    // Listeners are called as void(const Event&); connect free functions or members
+    template<typename Event>
+    auto sink() { return m_Dispatcher.sink<Event>(); }
+
+    // Disconnects every listener bound to 'instance', for all event types
+    template<typename Instance>
+    void disconnect(Instance& instance) { m_Dispatcher.disconnect(instance); }
+
+    // Queued until the next drain
+    template<typename Event>
+    void enqueue(Event&& event) { m_Dispatcher.enqueue(std::forward<Event>(event)); }
 
-    ApplicationEvents& getEventHandles() noexcept { return m_Events; }
-    const ApplicationEvents& getEventHandles() const noexcept { return m_Events; }
+    // Delivered right away
+    template<typename Event>
+    void trigger(Event&& event) { m_Dispatcher.trigger(std::forward<Event>(event)); }
+
+    // Polls the window and triggers the event types the application listens to, in poll
+    // order; the others are dropped
+    void pollWindowEvents(sf::Window& window);
+
+    // Delivers the queued events of one type, or of all types
+    template<typename Event>
+    void dispatchQueued() { m_Dispatcher.update<Event>(); }
+    void dispatchQueued() { m_Dispatcher.update(); }
+
+    // Drops queued events without delivering them
+    void clear() { m_Dispatcher.clear(); }
 
 private:
-    ApplicationEvents m_Events;
-};
\ No newline at end of file
+    // Global handlers (window close, Action::Quit)
+    void onClosed(const sf::Event::Closed& event);
+    void onKeyPressed(const sf::Event::KeyPressed& event);
+
+private:
+    AppContext* m_AppContext;
+    entt::dispatcher m_Dispatcher;
+};
@@ -0,0 +1,121 @@
+// Named input actions on top of a per-frame keyboard snapshot.
+// Key state is tracked from the KeyPressed/KeyReleased events on the GlobalEventManager bus,
+// so nothing asks the OS for key state during the frame. Application::processEvents()
+// opens a frame with beginFrame() before the window is polled and closes it with
+// endFrame() after the events were delivered. endFrame() folds the held keys into one
+// bitset of held actions, so the systems of every step in the frame see the same input.
+//
+// Pressed/released edges come from the events themselves: a tap that starts and ends within
+// one frame still reports wasPressed() and wasReleased(). Edges last for the whole rendered
+// frame, i.e. for every fixed step it runs (or none).
+//
+// Bindings are read from config/InputBindings.toml; the defaults below are used for the
+// actions the file doesn't list. All queries are O(1).
+//
+//     if (input.isDown(Action::MoveLeft)) { ... }
+//     if (input.isBound(Action::Pause, event.scancode)) { ... }     // in a KeyPressed handler
+
+#pragma once
+
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+class ConfigManager;
+class GlobalEventManager;
+
+enum class Action : std::uint8_t
+{
+    MoveUp,
+    MoveDown,
+    MoveLeft,
+    MoveRight,
+    Pause,
+    ToggleDebug,
+    SlowMotion,
+    FastForward,
+    ToggleLatency,
+    Quit,
+
+    Count
+};
+
+class InputManager
+{
+public:
+    static constexpr std::size_t ActionCount = static_cast<std::size_t>(Action::Count);
+    static constexpr std::size_t KeyCount = sf::Keyboard::ScancodeCount;
+
+    // Connects to the key and focus events of the bus, with the default bindings
+    explicit InputManager(GlobalEventManager& events);
+    InputManager(const InputManager&) = delete;
+    InputManager& operator=(const InputManager&) = delete;
+    ~InputManager();
+
+    // Replaces the bindings of every action listed in the [bindings] section.
+    // Unknown actions and key names are logged and skipped. Returns false if the config
+    // or the section is missing (the current bindings are kept).
+    bool loadBindings(const ConfigManager& config, std::string_view configID);
+
+    // A key can trigger several actions, and an action can have several keys
+    void bind(Action action, sf::Keyboard::Scancode key);
+    void unbind(Action action);
+
+    // Clears the previous frame's edges (before the window is polled)
+    void beginFrame() noexcept;
+    // Takes the action snapshot (after the frame's events were delivered)
+    void endFrame() noexcept;
+
+    // Queries on the current frame's snapshot
+    bool isDown(Action action) const noexcept { return m_Down.test(index(action)); }
+    bool wasPressed(Action action) const noexcept { return m_Pressed.test(index(action)); }
+    bool wasReleased(Action action) const noexcept { return m_Released.test(index(action)); }
+    bool isKeyDown(sf::Keyboard::Scancode key) const noexcept;
+
+    // For event handlers: does 'key' trigger 'action'?
+    bool isBound(Action action, sf::Keyboard::Scancode key) const noexcept;
+
+    static std::string_view getActionName(Action action) noexcept;
+    static std::optional<Action> parseAction(std::string_view name) noexcept;
+    // Names follow sf::Keyboard::Scan: "A".."Z", "Num0".."Num9", "F1".."F12", "Escape", ...
+    static std::optional<sf::Keyboard::Scancode> parseKey(std::string_view name) noexcept;
+
+private:
+    using ActionSet = std::bitset<ActionCount>;
+
+    static constexpr std::size_t index(Action action) noexcept
+    {
+        return static_cast<std::size_t>(action);
+    }
+    static std::optional<std::size_t> keyIndex(sf::Keyboard::Scancode key) noexcept;
+
+    void bindDefaults();
+
+    // Actions with at least one of their keys down right now (ORs the bound keys' sets)
+    ActionSet heldActions() const noexcept;
+
+    // Bus listeners
+    void onKeyPressed(const sf::Event::KeyPressed& event);
+    void onKeyReleased(const sf::Event::KeyReleased& event);
+    void onFocusLost(const sf::Event::FocusLost& event);
+    void onFocusGained(const sf::Event::FocusGained& event);
+
+private:
+    GlobalEventManager& m_Events;
+
+    std::bitset<KeyCount> m_KeysDown;
+    std::array<ActionSet, KeyCount> m_KeyActions{};     // Actions triggered by each key
+    std::vector<std::size_t> m_BoundKeys;               // Keys with at least one action
+
+    // Snapshot
+    ActionSet m_Down;
+    ActionSet m_Pressed;
+    ActionSet m_Released;
+};
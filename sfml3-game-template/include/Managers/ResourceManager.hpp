@@ -3,9 +3,11 @@
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <toml++/toml.hpp>
 
+#include "ECS/AnimationSheet.hpp"
 #include "Utilities/Logger.hpp"
 
 #include <map>
@@ -13,8 +15,12 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <cstddef>
 #include <functional>
 #include <format>
+#include <vector>
+
+namespace utils { class ThreadPool; }
 
 class ResourceManager
 {
@@ -24,11 +30,21 @@ public:
     ResourceManager& operator=(const ResourceManager&) = delete;
     ~ResourceManager() = default;
 
-    void loadAssetsFromManifest(std::string_view filepath);
+    // Loads every asset listed in the manifest and logs the total and per-asset times.
+    // With a thread pool, the asset files are read in one batch (utils::readFiles), image
+    // and sound bytes are decoded on its workers, and only the texture uploads and the
+    // final hand-off run on this thread. Without one, everything loads here, one file at
+    // a time (serial mode).
+    void loadAssetsFromManifest(std::string_view filepath, utils::ThreadPool* threadPool = nullptr);
 
     template<typename T>
     void loadResource(std::string_view id, std::string_view filepath);
 
+    // Fonts and music only: opens the asset from bytes already read ('source' names them in
+    // the log). The asset reads from 'data' for as long as it lives, so the manager keeps it.
+    template<typename T>
+    void loadResource(std::string_view id, std::vector<std::byte>&& data, std::string_view source);
+
     template<typename T>
     [[nodiscard]] T* getResource(std::string_view id);
 
@@ -36,10 +52,53 @@ public:
     [[nodiscard]] const T* getResource(std::string_view id) const;
 
 private:
+    struct ManifestEntry
+    {
+        std::string id;
+        std::string path;
+    };
+
+    struct ManifestEntries
+    {
+        std::vector<ManifestEntry> fonts;
+        std::vector<ManifestEntry> textures;
+        std::vector<ManifestEntry> animations;
+        std::vector<ManifestEntry> soundBuffers;
+        std::vector<ManifestEntry> musics;
+    };
+
+    // Time spent on one asset, for the load report (failed loads are reported too)
+    struct AssetTiming
+    {
+        std::string id;
+        float workerMs{ 0.0f };     // Decode on a worker (parallel mode)
+        float mainMs{ 0.0f };       // On the calling thread
+        bool loaded{ true };
+    };
+
+    // loadResource() plus its time in 'timings'
+    template<typename T>
+    void loadTimed(const ManifestEntry& entry, std::vector<AssetTiming>& timings);
+
+    void loadSerial(const ManifestEntries& entries, std::vector<AssetTiming>& timings);
+    void loadParallel(const ManifestEntries& entries, utils::ThreadPool& threadPool,
+                      std::vector<AssetTiming>& timings);
+
+    // Builds the sheet's pixel masks if the sheet asks for them, from 'image' if the
+    // texture's pixels are still around, else from a read-back of the texture
+    void buildPixelMasks(std::string_view sheetID, const sf::Image* image = nullptr);
+
+private:
+    // Fonts and music opened from memory read from these buffers for as long as they live,
+    // so the buffers are declared first (destroyed last)
+    std::map<std::string, std::vector<std::byte>, std::less<>> m_FontData;
+    std::map<std::string, std::vector<std::byte>, std::less<>> m_MusicData;
+
     std::map<std::string, std::unique_ptr<sf::Font>, std::less<>> m_Fonts;
     std::map<std::string, std::unique_ptr<sf::Texture>, std::less<>> m_Textures;
     std::map<std::string, std::unique_ptr<sf::SoundBuffer>, std::less<>> m_SoundBuffers;
     std::map<std::string, std::unique_ptr<sf::Music>, std::less<>> m_Musics;
+    std::map<std::string, std::unique_ptr<AnimationSheet>, std::less<>> m_AnimationSheets;
 
 };
 
@@ -55,6 +114,10 @@ void ResourceManager::loadResource(std::string_view id, std::string_view filepat
             return;
         }
         m_Fonts.insert_or_assign(std::string(id), std::move(font));
+        if (auto it = m_FontData.find(id); it != m_FontData.end())
+        {
+            m_FontData.erase(it);   // The replaced font no longer needs its buffer
+        }
         logger::Info(std::format("Font ID \"{}\" loaded from: {}", id, filepath));
     }
     else if constexpr (std::is_same_v<T, sf::Texture>)
@@ -88,8 +151,23 @@ void ResourceManager::loadResource(std::string_view id, std::string_view filepat
             return;
         }
         m_Musics.insert_or_assign(std::string(id), std::move(music));
+        if (auto it = m_MusicData.find(id); it != m_MusicData.end())
+        {
+            m_MusicData.erase(it);  // The replaced music no longer needs its buffer
+        }
         logger::Info(std::format("Music ID \"{}\" loaded from: {}", id, filepath));
     }
+    else if constexpr (std::is_same_v<T, AnimationSheet>)
+    {
+        auto sheet = std::make_unique<AnimationSheet>();
+        if (!sheet->loadFromFile(filepath))
+        {
+            logger::Error(std::format("Failed to load animation sheet: {}", filepath));
+            return;
+        }
+        m_AnimationSheets.insert_or_assign(std::string(id), std::move(sheet));
+        logger::Info(std::format("AnimationSheet ID \"{}\" loaded from: {}", id, filepath));
+    }
     else
     {
         logger::Error(std::format(
@@ -99,6 +177,44 @@ void ResourceManager::loadResource(std::string_view id, std::string_view filepat
     }
 }
 
+template<typename T>
+void ResourceManager::loadResource(std::string_view id, std::vector<std::byte>&& data,
+                                   std::string_view source)
+{
+    if constexpr (std::is_same_v<T, sf::Font>)
+    {
+        auto font = std::make_unique<sf::Font>();
+        if (!font->openFromMemory(data.data(), data.size()))
+        {
+            logger::Error(std::format("Failed to load font: {}", source));
+            return;
+        }
+        // The replaced font goes before the buffer it reads from
+        m_Fonts.insert_or_assign(std::string(id), std::move(font));
+        m_FontData.insert_or_assign(std::string(id), std::move(data));
+        logger::Info(std::format("Font ID \"{}\" loaded from: {}", id, source));
+    }
+    else if constexpr (std::is_same_v<T, sf::Music>)
+    {
+        auto music = std::make_unique<sf::Music>();
+        if (!music->openFromMemory(data.data(), data.size()))
+        {
+            logger::Error(std::format("Failed to load music: {}", source));
+            return;
+        }
+        m_Musics.insert_or_assign(std::string(id), std::move(music));
+        m_MusicData.insert_or_assign(std::string(id), std::move(data));
+        logger::Info(std::format("Music ID \"{}\" loaded from: {}", id, source));
+    }
+    else
+    {
+        logger::Error(std::format(
+            "Couldn't load resource from memory. Possibly: Unsupported type? (ID: {})",
+            id));
+        return;
+    }
+}
+
 template<typename T>
 T* ResourceManager::getResource(std::string_view id)
 {
@@ -122,6 +238,11 @@ T* ResourceManager::getResource(std::string_view id)
         auto it = m_Musics.find(id);
         return (it != m_Musics.end()) ? it->second.get() : nullptr;
     }
+    else if constexpr (std::is_same_v<T, AnimationSheet>)
+    {
+        auto it = m_AnimationSheets.find(id);
+        return (it != m_AnimationSheets.end()) ? it->second.get() : nullptr;
+    }
     else
     {
         logger::Error(std::format(
@@ -154,6 +275,11 @@ const T* ResourceManager::getResource(std::string_view id) const
         auto it = m_Musics.find(id);
         return (it != m_Musics.end()) ? it->second.get() : nullptr;
     }
+    else if constexpr (std::is_same_v<T, AnimationSheet>)
+    {
+        auto it = m_AnimationSheets.find(id);
+        return (it != m_AnimationSheets.end()) ? it->second.get() : nullptr;
+    }
     else
     {
         logger::Error(std::format(
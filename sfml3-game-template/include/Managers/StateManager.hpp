@@ -29,6 +29,7 @@ public:
     void replaceState(std::unique_ptr<State> state);
 
     void processPending();
+    bool hasPendingChanges() const noexcept { return !m_PendingChanges.empty(); }
 
     State* getCurrentState() noexcept;
     const State* getCurrentState() const noexcept;
@@ -0,0 +1,286 @@
+// Coroutine tasks for multi-step sequences (load -> fade -> push a state, cutscenes, scripted
+// behaviours) written as straight-line code instead of state flags polled every update:
+//
+//     Task introSequence(AppContext& context)
+//     {
+//         sf::Font* font = co_await WaitForAsset<sf::Font>{ *context.m_ResourceManager, "MainFont" };
+//         co_await WaitSeconds{ sf::seconds(1.0f) };
+//         auto result = co_await AwaitJob{ context.m_ThreadPool->submit([] { return crunch(); }) };
+//         co_await NextFrame{};
+//     }
+//     context.m_TaskScheduler->spawn(introSequence(context), TimeDomain::UI);
+//
+// The TaskScheduler resumes tasks once per rendered frame from Application::run(). Suspended
+// tasks cost nothing per frame, except those waiting on a condition (asset, job), which
+// are polled. Coroutine frames come from a size-class pool, so spawning doesn't hit the heap
+// once the pool is warm. Tasks are main-thread only; use AwaitJob for background work.
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include "Managers/ResourceManager.hpp"
+#include "Managers/TimeManager.hpp"
+#include "Utilities/InlineFunction.hpp"
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+class TaskScheduler;
+
+struct TaskHandle
+{
+    std::uint32_t index{ 0xFFFFFFFFu };
+    std::uint32_t generation{ 0 };
+
+    bool operator==(const TaskHandle&) const = default;
+};
+
+// Pooled storage for coroutine frames (main thread only)
+namespace TaskFrames
+{
+    void* allocate(std::size_t size);
+    void deallocate(void* frame, std::size_t size) noexcept;
+    std::size_t getReservedBytes() noexcept;
+}
+
+class Task
+{
+public:
+    struct promise_type;
+
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        // Continues the awaiting task, or reports a finished root task to the scheduler
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type
+    {
+        TaskScheduler* scheduler{ nullptr };
+        TaskHandle root;                            // Spawned task this one runs under
+        std::coroutine_handle<> continuation;      // Task awaiting this one, if any
+
+        Task get_return_object() noexcept
+        {
+            return Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+        // Lazy: runs once spawned or awaited
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept;
+
+        static void* operator new(std::size_t size) { return TaskFrames::allocate(size); }
+        static void operator delete(void* frame, std::size_t size) noexcept
+        {
+            TaskFrames::deallocate(frame, size);
+        }
+    };
+
+    Task() noexcept = default;
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            m_Handle = std::exchange(other.m_Handle, {});
+        }
+        return *this;
+    }
+    ~Task() { destroy(); }
+
+    // 'co_await childTask()' runs the child inside the same spawned task
+    bool await_ready() const noexcept { return !m_Handle || m_Handle.done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> parent) noexcept
+    {
+        promise_type& child = m_Handle.promise();
+        child.scheduler = parent.promise().scheduler;
+        child.root = parent.promise().root;
+        child.continuation = parent;
+        return m_Handle;
+    }
+    void await_resume() const noexcept {}
+
+private:
+    friend class TaskScheduler;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : m_Handle(handle) {}
+
+    void destroy() noexcept
+    {
+        if (m_Handle)
+        {
+            m_Handle.destroy();
+            m_Handle = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_Handle;
+};
+
+class TaskScheduler
+{
+public:
+    using Condition = utils::InlineFunction<bool(), 32>;
+
+    TaskScheduler() = default;
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+    // Destroys every unfinished task
+    ~TaskScheduler();
+
+    // Starts the task right away (up to its first suspension). WaitSeconds inside it uses
+    // the domain's clock, so World tasks stop while the world is paused or not running.
+    TaskHandle spawn(Task task, TimeDomain domain = TimeDomain::World);
+
+    // Destroys the task's frames (and any child tasks it is awaiting)
+    bool cancel(TaskHandle handle);
+    void cancelAll(TimeDomain domain);
+    bool isRunning(TaskHandle handle) const noexcept;
+
+    // Once per rendered frame: advances the domain clocks and resumes the tasks that are ready
+    void update(const TimeManager& time, sf::Time realFrameTime);
+
+    std::size_t getTaskCount() const noexcept { return m_TaskCount; }
+
+    //$ ----- Used by the awaitables ----- //
+    void waitNextFrame(TaskHandle root, std::coroutine_handle<> handle);
+    void waitFor(TaskHandle root, std::coroutine_handle<> handle, sf::Time duration);
+    void waitUntil(TaskHandle root, std::coroutine_handle<> handle, Condition ready);
+    void markFinished(TaskHandle root);
+
+private:
+    struct Root
+    {
+        std::coroutine_handle<Task::promise_type> handle;
+        std::uint32_t generation{ 0 };
+        TimeDomain domain{ TimeDomain::World };
+        bool alive{ false };
+        bool cancelled{ false };    // Waiting to be destroyed once nothing runs
+    };
+
+    struct Waiter
+    {
+        TaskHandle root;
+        std::coroutine_handle<> handle;
+    };
+
+    struct TimedWaiter
+    {
+        double wakeTime{ 0.0 };
+        Waiter waiter;
+
+        // Min-heap on wake time
+        bool operator<(const TimedWaiter& other) const noexcept { return wakeTime > other.wakeTime; }
+    };
+
+    struct PolledWaiter
+    {
+        Waiter waiter;
+        Condition ready;
+    };
+
+    static constexpr std::size_t DomainCount = static_cast<std::size_t>(TimeDomain::Count);
+
+    void resume(const Waiter& waiter);
+    void destroyRoot(TaskHandle handle);
+    void reapFinished();
+
+    std::vector<Root> m_Roots;
+    std::vector<std::uint32_t> m_FreeRoots;
+    std::size_t m_TaskCount{ 0 };
+
+    std::vector<Waiter> m_NextFrame;
+    std::vector<Waiter> m_Resuming;                     // Reused by update()
+    std::array<std::vector<TimedWaiter>, DomainCount> m_Timed;
+    std::vector<PolledWaiter> m_Polled;
+    std::array<double, DomainCount> m_Now{};           // Seconds of each domain's clock
+
+    std::vector<TaskHandle> m_Finished;
+    int m_ResumeDepth{ 0 };                            // > 0 while a task is running
+};
+
+//$ ----- Awaitables ----- //
+
+// Resumes on the next rendered frame
+struct NextFrame
+{
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle) const
+    {
+        handle.promise().scheduler->waitNextFrame(handle.promise().root, handle);
+    }
+    void await_resume() const noexcept {}
+};
+
+// Resumes after 'duration' of the task's time domain
+struct WaitSeconds
+{
+    sf::Time duration;
+
+    bool await_ready() const noexcept { return duration <= sf::Time::Zero; }
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle) const
+    {
+        handle.promise().scheduler->waitFor(handle.promise().root, handle, duration);
+    }
+    void await_resume() const noexcept {}
+};
+
+// Resumes once the ResourceManager has the asset and returns it
+template<typename T>
+struct WaitForAsset
+{
+    ResourceManager& resources;
+    std::string id;
+    T* resource{ nullptr };
+
+    bool await_ready()
+    {
+        resource = resources.getResource<T>(id);
+        return resource != nullptr;
+    }
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle)
+    {
+        handle.promise().scheduler->waitUntil(handle.promise().root, handle, [this]()
+        {
+            resource = resources.getResource<T>(id);
+            return resource != nullptr;
+        });
+    }
+    T* await_resume() const noexcept { return resource; }
+};
+
+// Resumes once a ThreadPool job has finished and returns its result:
+// 'co_await AwaitJob{ pool.submit(job) }'
+template<typename R>
+struct AwaitJob
+{
+    std::future<R> future;
+
+    bool await_ready() const
+    {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle)
+    {
+        handle.promise().scheduler->waitUntil(handle.promise().root, handle,
+                                              [this]() { return await_ready(); });
+    }
+    R await_resume() { return future.get(); }
+};
+
+template<typename R>
+AwaitJob(std::future<R>) -> AwaitJob<R>;
@@ -0,0 +1,84 @@
+// Virtual clock layer between AppContext::m_MainClock and the states.
+// Each time domain has its own scale, so the world can run in slow motion (or be
+// frozen) while menus keep animating at normal speed. Application::run() scales the
+// real frame time by the domain of the top state before feeding the fixed-step loop.
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class TimeDomain : std::uint8_t
+{
+    World,  // Gameplay simulation (PlayState)
+    UI,     // Menus and overlays
+    Audio,  // Mapped to music pitch by the states that own music
+    Count
+};
+
+class TimeManager
+{
+public:
+    TimeManager();
+    TimeManager(const TimeManager&) = delete;
+    TimeManager& operator=(const TimeManager&) = delete;
+    ~TimeManager() = default;
+
+    // Scale 1.0 is real time, 0.5 half speed, etc. Clamped to [0, MaxScale].
+    void setScale(TimeDomain domain, float scale);
+    float getScale(TimeDomain domain) const noexcept { return m_Domains[index(domain)].scale; }
+
+    // Pausing keeps the scale, so resuming returns to the previous speed
+    void setPaused(TimeDomain domain, bool paused);
+    bool isPaused(TimeDomain domain) const noexcept { return m_Domains[index(domain)].paused; }
+
+    // 0 while paused, otherwise the domain's scale
+    float getEffectiveScale(TimeDomain domain) const noexcept;
+    sf::Time scale(TimeDomain domain, sf::Time realTime) const noexcept;
+
+    // Total scaled time that has been simulated in this domain
+    sf::Time getElapsed(TimeDomain domain) const noexcept { return m_Domains[index(domain)].elapsed; }
+    void advance(TimeDomain domain, sf::Time scaledTime) noexcept;
+
+    //$ ----- Fast-forward ----- //
+    // While enabled, World-domain states run as many fixed steps per rendered frame as
+    // fit in the CPU budget, ignoring real time
+    void setFastForward(bool enabled);
+    bool isFastForward() const noexcept { return m_FastForward; }
+
+    void setFastForwardBudget(sf::Time budget);
+    sf::Time getFastForwardBudget() const noexcept { return m_FastForwardBudget; }
+
+    // Called once per rendered frame with the real frame time and the simulated time
+    void recordFrame(sf::Time realTime, sf::Time simulatedTime);
+
+    // Simulated seconds per real second, measured over the last half second
+    float getAchievedSpeed() const noexcept { return m_AchievedSpeed; }
+
+    static constexpr float MaxScale = 16.0f;
+
+private:
+    struct DomainClock
+    {
+        float scale{ 1.0f };
+        bool paused{ false };
+        sf::Time elapsed{ sf::Time::Zero };
+    };
+
+    static constexpr std::size_t index(TimeDomain domain) noexcept
+    {
+        return static_cast<std::size_t>(domain);
+    }
+
+    std::array<DomainClock, static_cast<std::size_t>(TimeDomain::Count)> m_Domains;
+
+    bool m_FastForward{ false };
+    sf::Time m_FastForwardBudget{ sf::milliseconds(12) };
+
+    sf::Time m_SpeedWindowReal{ sf::Time::Zero };
+    sf::Time m_SpeedWindowSimulated{ sf::Time::Zero };
+    float m_AchievedSpeed{ 1.0f };
+};
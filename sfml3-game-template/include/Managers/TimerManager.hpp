@@ -0,0 +1,117 @@
+// Scheduled callbacks ("in 2 seconds", "every 0.5 seconds") on a hierarchical timing wheel.
+// Time is counted in fixed simulation steps, per TimeDomain, so world timers stop while
+// the game is paused and run faster in fast-forward. Application::step() fires every due
+// timer of the top state's domain in one batch right after the state's update.
+//
+// Four wheels of 64 slots cover 64^4 steps (about 77 hours at 60 Hz); longer delays are
+// parked in the last slot and re-filed as they come closer. Insert and cancel are O(1),
+// and callbacks live in a slab of InlineFunctions, so scheduling never allocates once the
+// slab has grown to the peak timer count.
+
+#pragma once
+
+#include <SFML/System/Time.hpp>
+#include <entt/entt.hpp>
+
+#include "Managers/TimeManager.hpp"
+#include "Utilities/InlineFunction.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+// Generation-checked reference to a timer. Stale handles (fired or cancelled timers whose
+// slot was reused) are simply ignored.
+struct TimerHandle
+{
+    std::uint32_t index{ 0xFFFFFFFFu };
+    std::uint32_t generation{ 0 };
+
+    bool operator==(const TimerHandle&) const = default;
+};
+
+// Timers owned by an entity: cancelled when the entity is destroyed or parked in a pool.
+// Add them with TimerManager::attach().
+struct TimerComponent { std::vector<TimerHandle> handles; };
+
+class TimerManager
+{
+public:
+    using Callback = utils::InlineFunction<void(), 48>;
+
+    explicit TimerManager(entt::registry& registry);
+    TimerManager(const TimerManager&) = delete;
+    TimerManager& operator=(const TimerManager&) = delete;
+    ~TimerManager();
+
+    // Length of one step (the fixed time step); delays are rounded up to whole steps
+    void setTickDuration(sf::Time tickDuration);
+
+    TimerHandle after(sf::Time delay, Callback callback, TimeDomain domain = TimeDomain::World);
+    TimerHandle every(sf::Time interval, Callback callback, TimeDomain domain = TimeDomain::World);
+
+    // Returns false if the timer already fired (one-shot) or was cancelled
+    bool cancel(TimerHandle handle);
+    bool isActive(TimerHandle handle) const noexcept;
+
+    // Ties the timer's lifetime to the entity (see TimerComponent)
+    void attach(entt::entity entity, TimerHandle handle);
+
+    // One fixed step of 'domain': fires every timer that is now due
+    void advance(TimeDomain domain);
+
+    // Cancels every timer of the domain (e.g. when a game session ends)
+    void clear(TimeDomain domain);
+
+    std::size_t getActiveCount() const noexcept { return m_ActiveCount; }
+
+private:
+    static constexpr int SlotBits = 6;
+    static constexpr std::uint32_t SlotCount = 1u << SlotBits;
+    static constexpr std::uint32_t SlotMask = SlotCount - 1;
+    static constexpr int LevelCount = 4;
+    static constexpr std::uint32_t None = 0xFFFFFFFFu;
+    static constexpr std::uint16_t Unfiled = 0xFFFFu;
+
+    struct Timer
+    {
+        Callback callback;
+        std::uint64_t expiry{ 0 };          // Absolute step of the domain
+        std::uint32_t interval{ 0 };        // Steps between repeats, 0 = one-shot
+        std::uint32_t generation{ 0 };
+        std::uint32_t prev{ None };         // Intrusive list of the slot it's filed in
+        std::uint32_t next{ None };
+        std::uint16_t slot{ Unfiled };      // level * SlotCount + slot index
+        TimeDomain domain{ TimeDomain::World };
+        bool active{ false };
+    };
+
+    struct Wheel
+    {
+        std::uint64_t currentStep{ 0 };
+        std::array<std::uint32_t, LevelCount * SlotCount> heads;
+    };
+
+    TimerHandle schedule(std::uint32_t delaySteps, std::uint32_t interval,
+                         Callback&& callback, TimeDomain domain);
+    std::uint32_t toSteps(sf::Time time) const noexcept;
+
+    void file(std::uint32_t index);      // Links the timer into the slot for its expiry
+    void unlink(std::uint32_t index);
+    void release(std::uint32_t index);   // Back to the free list, invalidates handles
+    void cascade(Wheel& wheel, int level);
+
+    void onTimerOwnerGone(entt::registry& registry, entt::entity entity);
+
+    entt::registry& m_Registry;
+    sf::Time m_TickDuration{ sf::seconds(1.0f / 60.0f) };
+
+    std::array<Wheel, static_cast<std::size_t>(TimeDomain::Count)> m_Wheels;
+    std::deque<Timer> m_Timers;             // Deque: callbacks stay put while others are added
+    std::vector<std::uint32_t> m_FreeList;
+    std::vector<TimerHandle> m_DueBatch;    // Reused by advance()
+    std::uint32_t m_Firing{ None };         // Timer whose callback is running right now
+    std::size_t m_ActiveCount{ 0 };
+};
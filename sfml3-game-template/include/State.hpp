@@ -2,20 +2,24 @@
 
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
 
 #include "AppContext.hpp"
+#include "Managers/TimeManager.hpp"
+#include "Utilities/InlineFunction.hpp"
 
-#include <functional>
 #include <optional>
 
+// Handlers are stored inline (no heap allocation); captures up to 32 bytes
 struct StateEvents
 {
-	std::function<void(const sf::Event::KeyPressed&)> onKeyPress = [](const auto&){};
-    std::function<void(const sf::Event::MouseButtonPressed&)> onMouseButtonPress = [](const auto&){};
+    utils::InlineFunction<void(const sf::Event::KeyPressed&), 32> onKeyPress = [](const auto&){};
+    utils::InlineFunction<void(const sf::Event::MouseButtonPressed&), 32> onMouseButtonPress
+        = [](const auto&){};
 };
 
 enum class TransitionType
@@ -37,6 +41,9 @@ public:
     virtual void update(sf::Time deltaTime) = 0;
     virtual void render() = 0;
 
+    // Which TimeManager scale drives this state's fixed-step updates
+    virtual TimeDomain getTimeDomain() const noexcept { return TimeDomain::World; }
+
 protected:
     AppContext& m_AppContext;
     StateEvents m_StateEvents;
@@ -57,6 +64,7 @@ public:
 
     virtual void update(sf::Time deltaTime) override;
     virtual void render() override;
+    virtual TimeDomain getTimeDomain() const noexcept override { return TimeDomain::UI; }
 
 private:
     void initTitleText();
@@ -75,15 +83,19 @@ public:
 
     virtual void update(sf::Time deltaTime) override;
     virtual void render() override;
+    virtual TimeDomain getTimeDomain() const noexcept override { return TimeDomain::UI; }
     
 private:
     void initMenuButtons();
+    void initToggleOverlays();
     void assignStateEvents();
 
+    // AppSettings::onChanged handler: updates the mute overlays
+    void onSettingChanged(SettingID setting);
+
 private:
     sf::RectangleShape m_Background;
-    std::optional<sf::Text> m_MusicVolumeText;
-    std::optional<sf::Text> m_SfxVolumeText;
+    std::optional<sf::Sprite> m_RedXSprite;
     bool m_FromPlayState;
 };
 
@@ -96,6 +108,9 @@ public:
     virtual void update(sf::Time deltaTime) override;
     virtual void render() override;
 
+private:
+    void cycleSlowMotion();
+
 private:
     sf::Music* m_Music{ nullptr };
     bool m_ShowDebug{ false };
@@ -109,6 +124,7 @@ public:
 
     virtual void update(sf::Time deltaTime) override;
     virtual void render() override;
+    virtual TimeDomain getTimeDomain() const noexcept override { return TimeDomain::UI; }
 
 private:
     std::optional<sf::Text> m_PauseText;
@@ -123,6 +139,7 @@ public:
 
     virtual void update(sf::Time deltaTime) override;
     virtual void render() override;
+    virtual TimeDomain getTimeDomain() const noexcept override { return TimeDomain::UI; }
 
 private:
     std::optional<sf::Text> m_TransitionText;
@@ -0,0 +1,49 @@
+// Batched whole-file reads for the asset pipeline. readFiles() sizes every buffer up front
+// (fstat) and keeps all reads in flight at once, so a cold cache on a spinning disk or a
+// network filesystem pays for one round of seeks/latency instead of one per file:
+//   - Linux, built with SFML_TEMPLATE_IO_URING: one io_uring (raw syscalls, no liburing),
+//     every read submitted in one go; short reads are resubmitted for the remainder
+//   - otherwise, or if the kernel refuses io_uring (old kernel, seccomp in containers):
+//     one pread() job per file on the ThreadPool
+//   - without a pool: the same reads on the calling thread, one file at a time
+// Decoders then build assets from the buffers with loadFromMemory()/openFromMemory().
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+    class ThreadPool;
+
+    enum class FileReadBackend
+    {
+        IoUring,
+        ThreadPool,
+        Serial
+    };
+
+    struct FileBuffer
+    {
+        std::vector<std::byte> bytes;
+        bool loaded{ false };       // False if the file couldn't be opened or read
+    };
+
+    struct FileBatch
+    {
+        std::vector<FileBuffer> files;      // In the order of the requested paths
+        FileReadBackend backend{ FileReadBackend::Serial };
+    };
+
+    // Reads every file whole. Blocks until all reads are done. 'preferred' is the first
+    // backend to try, in the order above (e.g. ThreadPool skips io_uring); the batch
+    // reports the one actually used.
+    [[nodiscard]] FileBatch readFiles(std::span<const std::string> paths, ThreadPool* threadPool,
+                                      FileReadBackend preferred = FileReadBackend::IoUring);
+
+    std::string_view toString(FileReadBackend backend) noexcept;
+}
@@ -0,0 +1,83 @@
+// Frame rate limiter that replaces sf::Window::setFramerateLimit().
+// setFramerateLimit() only calls sf::sleep(), which wakes up whenever the OS scheduler
+// gets around to it. FramePacer sleeps until shortly before the deadline and spin-waits
+// the rest. Deadlines are absolute (previous deadline + period), so small oversleeps are
+// paid back next frame instead of accumulating as drift, and so are frames that run a
+// little late. Only a stall of more than a whole period restarts the schedule from now,
+// so it isn't followed by a burst of catch-up frames.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace utils
+{
+    struct FramePacerStats
+    {
+        // Measured frame interval
+        float meanFrameMs{ 0.0f };
+        float p99FrameMs{ 0.0f };
+
+        // Deviation of the frame interval from the target period (from the mean interval
+        // when pacing is off)
+        float meanJitterMs{ 0.0f };
+        float p99JitterMs{ 0.0f };
+        float maxJitterMs{ 0.0f };
+        std::size_t samples{ 0 };
+
+        std::uint64_t missedDeadlines{ 0 };  // Frames that were already late when paced
+        std::uint64_t resyncs{ 0 };          // Misses that were more than a whole period late
+    };
+
+    class FramePacer
+    {
+    public:
+        FramePacer();
+        FramePacer(const FramePacer&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+        ~FramePacer() = default;
+
+        // 0 disables pacing (waitForNextFrame() returns immediately but still records stats)
+        void setTargetRate(unsigned int framesPerSecond);
+        unsigned int getTargetRate() const noexcept { return m_TargetRate; }
+
+        // Minimum time left before the deadline that is spun instead of slept.
+        // The pacer widens this on its own if the OS oversleeps by more.
+        void setSpinThreshold(std::chrono::microseconds threshold);
+
+        // Blocks until the next frame deadline. Call once per frame, right after display().
+        void waitForNextFrame();
+
+        // Starts a new schedule from now (e.g. after loading or a state change that stalled)
+        void resync();
+
+        [[nodiscard]] FramePacerStats getStats() const;
+        void logStats() const;
+        void resetStats();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void recordFrame(Clock::time_point now);
+
+        static constexpr std::size_t MaxFrameSamples = 1024;
+
+        unsigned int m_TargetRate{ 0 };
+        Clock::duration m_Period{ Clock::duration::zero() };
+        Clock::duration m_SpinThreshold{ std::chrono::microseconds(1500) };
+        Clock::duration m_SleepOvershoot{ Clock::duration::zero() };   // Worst recent oversleep
+
+        Clock::time_point m_NextDeadline{};
+        Clock::time_point m_LastFrame{};
+        bool m_Started{ false };
+
+        // Ring buffer of frame intervals in milliseconds
+        std::vector<float> m_FrameSamples;
+        std::size_t m_NextSample{ 0 };
+        std::uint64_t m_MissedDeadlines{ 0 };
+        std::uint64_t m_Resyncs{ 0 };
+    };
+}
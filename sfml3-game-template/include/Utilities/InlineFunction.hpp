@@ -0,0 +1,135 @@
+// std::function replacement that never allocates.
+// The callable is stored inside the object (up to 'Capacity' bytes); anything larger is a
+// compile error instead of a silent heap allocation, so keep captures small (a pointer or
+// two, an entity, a handle). Move-only, like std::move_only_function, so it can hold
+// move-only callables; a null function or member pointer gives an empty function.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace utils
+{
+    template<typename Signature, std::size_t Capacity = 48>
+    class InlineFunction;
+
+    template<typename R, typename... Args, std::size_t Capacity>
+    class InlineFunction<R(Args...), Capacity>
+    {
+    public:
+        InlineFunction() noexcept = default;
+        InlineFunction(std::nullptr_t) noexcept {}
+
+        template<typename F>
+            requires (!std::is_same_v<std::remove_cvref_t<F>, InlineFunction>
+                      && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+        InlineFunction(F&& callable)
+        {
+            using Fn = std::decay_t<F>;
+            static_assert(sizeof(Fn) <= Capacity,
+                          "Callable too large for InlineFunction: capture less or raise Capacity");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                          "Callable is over-aligned for InlineFunction");
+            static_assert(std::is_nothrow_move_constructible_v<Fn>,
+                          "InlineFunction callables must be nothrow movable");
+
+            if constexpr (std::is_pointer_v<Fn> || std::is_member_pointer_v<Fn>)
+            {
+                if (callable == nullptr)
+                {
+                    return;     // Stays empty, like std::function
+                }
+            }
+
+            ::new (static_cast<void*>(m_Storage)) Fn(std::forward<F>(callable));
+            m_Ops = &OpsFor<Fn>;
+        }
+
+        InlineFunction(const InlineFunction&) = delete;
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        InlineFunction(InlineFunction&& other) noexcept
+        {
+            moveFrom(other);
+        }
+
+        InlineFunction& operator=(InlineFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        InlineFunction& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        ~InlineFunction()
+        {
+            reset();
+        }
+
+        R operator()(Args... args) const
+        {
+            assert(m_Ops && "Calling an empty InlineFunction");
+            return m_Ops->invoke(m_Storage, std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const noexcept { return m_Ops != nullptr; }
+
+        void reset() noexcept
+        {
+            if (m_Ops)
+            {
+                m_Ops->destroy(m_Storage);
+                m_Ops = nullptr;
+            }
+        }
+
+    private:
+        struct Ops
+        {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*move)(void* destination, void* source) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template<typename Fn>
+        static constexpr Ops OpsFor{
+            [](void* storage, Args&&... args) -> R
+            {
+                return std::invoke_r<R>(*static_cast<Fn*>(storage), std::forward<Args>(args)...);
+            },
+            [](void* destination, void* source) noexcept
+            {
+                ::new (destination) Fn(std::move(*static_cast<Fn*>(source)));
+                static_cast<Fn*>(source)->~Fn();
+            },
+            [](void* storage) noexcept { static_cast<Fn*>(storage)->~Fn(); }
+        };
+
+        void moveFrom(InlineFunction& other) noexcept
+        {
+            if (other.m_Ops)
+            {
+                other.m_Ops->move(m_Storage, other.m_Storage);
+                m_Ops = other.m_Ops;
+                other.m_Ops = nullptr;
+            }
+        }
+
+        // Mutable so const calls can run callables with mutable state, like std::function
+        alignas(std::max_align_t) mutable std::byte m_Storage[Capacity];
+        const Ops* m_Ops{ nullptr };
+    };
+}
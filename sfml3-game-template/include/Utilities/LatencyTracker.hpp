@@ -0,0 +1,99 @@
+// Input-to-present latency: how long an input event waits between being taken from the
+// window and the display() of the first frame that could show its effect.
+//
+// Each frame contributes at most one sample, for its oldest input event:
+//   polled    GlobalEventManager::pollWindowEvents() stamps every input event
+//   stepped   the first simulation step after the poll consumes it (Application::step();
+//             the InputManager snapshot is read by every step of the frame)
+//   presented display() returned (Application::render())
+// Input polled on a frame that runs no step (slow motion on a fast display) waits for the
+// next step, and that wait is part of the sample.
+//
+// Measured up to display() returning, not to light leaving the screen: the compositor and
+// the monitor add a constant on top, so use the numbers to compare settings, not as an
+// absolute.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+    struct LatencyStats
+    {
+        // Poll -> present
+        float p50Ms{ 0.0f };
+        float p95Ms{ 0.0f };
+        float p99Ms{ 0.0f };
+        float maxMs{ 0.0f };
+        // Where the time went, on average
+        float meanPollToStepMs{ 0.0f };
+        float meanStepToPresentMs{ 0.0f };
+        std::size_t samples{ 0 };
+    };
+
+    class LatencyTracker
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        LatencyTracker();
+        LatencyTracker(const LatencyTracker&) = delete;
+        LatencyTracker& operator=(const LatencyTracker&) = delete;
+        ~LatencyTracker();
+
+        // An input event was taken from the window
+        void inputPolled(Clock::time_point polledAt) noexcept;
+        // A simulation step starts and consumes the input polled before it
+        void stepStarted(Clock::time_point now) noexcept;
+        // display() returned; records the sample and writes a report row when one is due
+        void framePresented(Clock::time_point now);
+
+        // Percentiles over the last MaxSamples samples
+        [[nodiscard]] LatencyStats getStats() const;
+        void logStats() const;
+        void resetStats();
+
+        // Appends one CSV row to 'path' every 'interval', with the percentiles of the
+        // samples since the previous row. 'label' (e.g. the vsync/pacing settings) heads
+        // this run's rows so runs with different settings can be compared.
+        // Returns false if the file can't be opened.
+        bool openReport(const std::string& path, std::chrono::milliseconds interval,
+                        std::string_view label);
+
+    private:
+        struct Sample
+        {
+            float totalMs;
+            float pollToStepMs;
+        };
+
+        static LatencyStats computeStats(std::vector<Sample> samples);
+        void writeReportRow(Clock::time_point now);
+
+        static constexpr std::size_t MaxSamples = 1024;
+
+        // Oldest input not yet presented
+        Clock::time_point m_PolledAt{};
+        Clock::time_point m_SteppedAt{};
+        bool m_Pending{ false };
+        bool m_Consumed{ false };
+
+        // Ring buffer for getStats()
+        std::vector<Sample> m_Samples;
+        std::size_t m_NextSample{ 0 };
+
+        // CSV report
+        std::ofstream m_Report;
+        std::vector<Sample> m_ReportSamples;    // Since the last row
+        Clock::duration m_ReportInterval{ Clock::duration::zero() };
+        Clock::time_point m_ReportStart{};
+        Clock::time_point m_LastReport{};
+        std::size_t m_ReportFrames{ 0 };
+    };
+}
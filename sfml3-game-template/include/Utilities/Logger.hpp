@@ -31,6 +31,7 @@ namespace logger
 {
     enum class LogLevel
     {
+        Debug,      // We'll use Cyan
         Info,       // We'll use Green
         Warning,    // We'll use Yellow
         Error,      // We'll use Red
@@ -183,6 +184,10 @@ namespace logger
                             colorStr = Color::Green;
                             levelStr = "INFO";
                             break;
+                        case LogLevel::Debug:
+                            colorStr = Color::Cyan;
+                            levelStr = "DEBUG";
+                            break;
                         default:
                             // something went wrong
                             colorStr = Color::White;
@@ -254,8 +259,8 @@ namespace logger
         // if you uncomment the line above, then comment the line below
         inline std::atomic<LogLevel> currentLevel = LogLevel::Info;
     #else
-    // For non-release builds, we'll print Warning and Info logs too
-        inline std::atomic<LogLevel> currentLevel = LogLevel::Info;
+    // For non-release builds, we'll print Debug, Info and Warning logs too
+        inline std::atomic<LogLevel> currentLevel = LogLevel::Debug;
     #endif
 
     inline void setLevel(LogLevel level)
@@ -263,9 +268,14 @@ namespace logger
         currentLevel.store(level, std::memory_order_relaxed);
     }
 
+    inline LogLevel getLevel()
+    {
+        return currentLevel.load(std::memory_order_relaxed);
+    }
+
     inline void forceVerbose()
     {
-        currentLevel.store(LogLevel::Info, std::memory_order_relaxed);
+        currentLevel.store(LogLevel::Debug, std::memory_order_relaxed);
     }
 
     inline void Print(LogLevel level, std::string_view message, const std::source_location& loc)
@@ -285,6 +295,12 @@ namespace logger
         detail::getWorker().push(std::move(entry));
     }
 
+    inline void Debug(std::string_view message,
+        const std::source_location& loc = std::source_location::current())
+    {
+        Print(LogLevel::Debug, message, loc);
+    }
+
     inline void Info(std::string_view message,
         const std::source_location& loc = std::source_location::current())
     {
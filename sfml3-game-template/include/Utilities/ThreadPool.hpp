@@ -0,0 +1,61 @@
+// Fixed set of worker threads for background jobs (flow fields, asset decoding, ...).
+// submit() returns a std::future; poll it with wait_for(0s) from the main thread instead
+// of blocking the frame. Jobs must not touch the registry or SFML graphics objects.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace utils
+{
+    class ThreadPool
+    {
+    public:
+        // 0 = one worker per hardware thread, minus one for the main thread (at least 1)
+        explicit ThreadPool(std::size_t threadCount = 0);
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        // Finishes the jobs already queued, then joins the workers
+        ~ThreadPool();
+
+        template<typename F>
+        [[nodiscard]] auto submit(F&& job) -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+
+        std::size_t getThreadCount() const noexcept { return m_Workers.size(); }
+        std::size_t getQueuedCount() const;
+
+    private:
+        void workerLoop(std::stop_token stopToken);
+
+        mutable std::mutex m_Mutex;
+        std::condition_variable_any m_Condition;
+        std::deque<std::move_only_function<void()>> m_Jobs;
+        std::vector<std::jthread> m_Workers;
+    };
+
+    template<typename F>
+    auto ThreadPool::submit(F&& job) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+
+        std::packaged_task<Result()> task(std::forward<F>(job));
+        auto future = task.get_future();
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_Jobs.emplace_back([task = std::move(task)]() mutable { task(); });
+        }
+        m_Condition.notify_one();
+
+        return future;
+    }
+}
@@ -7,6 +7,8 @@
 
 #include "Managers/ConfigManager.hpp"
 
+#include <cstddef>
+#include <span>
 #include <string_view>
 
 struct SpritePadding
@@ -26,6 +28,10 @@ namespace utils
                                 std::string_view colorKey);
 
     SpritePadding getSpritePadding(const sf::Sprite& sprite);
+
+    // Writes the value truncated to a whole number into 'buffer' and returns the length.
+    // Doesn't allocate (used as a TextBinding formatter).
+    std::size_t formatInteger(std::span<char> buffer, float value);
     
     // For now this only works with rectangles (I think), I'll extend it to other
     // types if needed later
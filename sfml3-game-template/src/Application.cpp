@@ -1,6 +1,7 @@
 #include "Application.hpp"
 
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/System/Clock.hpp>
@@ -8,11 +9,21 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
 
+#include "ECS/HoverTracker.hpp"
+#include "ECS/Layout.hpp"
+#include "ECS/Systems.hpp"
+#include "Managers/InputManager.hpp"
+#include "Utilities/LatencyTracker.hpp"
 #include "Utilities/Logger.hpp"
 #include "Utilities/Utils.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <format>
 #include <memory>
+#include <string>
 
 Application::Application()
     : m_AppContext()
@@ -21,9 +32,12 @@ Application::Application()
     // Initialize Application Window and data
     initMainWindow();
     initResources();
+    initSimulation();
+    initLatencyTracking();
 
     // Set the StateManager in AppContext to Application's StateManager
     m_AppContext.m_StateManager = &m_StateManager;
+    connectEvents();
 
     // Push the initial application state
     auto menuState = std::make_unique<MenuState>(m_AppContext);
@@ -34,6 +48,7 @@ Application::Application()
 
 Application::~Application()
 {
+    m_AppContext.m_GlobalEventManager->disconnect(*this);
     // WindowManager destructor will handle window cleanup
 }
 
@@ -42,7 +57,7 @@ void Application::initMainWindow()
     if (m_AppContext.m_WindowManager->createMainWindow())
     {
         m_AppContext.m_MainWindow = &m_AppContext.m_WindowManager->getMainWindow();
-        m_AppContext.m_MainWindow->setFramerateLimit(60);
+        initFramePacing();
 
         logger::Info(std::format("Main window created."));
     }
@@ -53,9 +68,103 @@ void Application::initMainWindow()
     }
 }
 
+void Application::initFramePacing()
+{
+    auto& config = *m_AppContext.m_ConfigManager;
+    auto& pacer = *m_AppContext.m_FramePacer;
+
+    unsigned int frameRate = config.getConfigValue<unsigned int>(
+                    Assets::Configs::Window, "display", "FrameRate").value_or(60);
+    std::string vsync = config.getConfigValue<std::string>(
+                    Assets::Configs::Window, "display", "VSync").value_or("off");
+    int spinMicros = config.getConfigValue<int>(
+                    Assets::Configs::Window, "display", "SpinMicros").value_or(1500);
+
+    if (vsync != "off" && vsync != "on" && vsync != "capped")
+    {
+        logger::Warn(std::format("Unknown VSync policy \"{}\". Using \"off\".", vsync));
+        vsync = "off";
+    }
+
+    // Never combine our own pacing with SFML's sleep-based limiter
+    m_AppContext.m_MainWindow->setFramerateLimit(0);
+    m_AppContext.m_MainWindow->setVerticalSyncEnabled(vsync != "off");
+
+    // With plain vsync the driver blocks in display(), so the pacer only measures
+    pacer.setTargetRate(vsync == "on" ? 0 : frameRate);
+    pacer.setSpinThreshold(std::chrono::microseconds(std::max(spinMicros, 0)));
+
+    logger::Info(std::format("Frame pacing: VSync {}, target {} FPS.", vsync,
+                             pacer.getTargetRate() == 0 ? std::string("uncapped")
+                                                        : std::to_string(pacer.getTargetRate())));
+}
+
 void Application::initResources()
 {
-    m_AppContext.m_ResourceManager->loadAssetsFromManifest("config/AssetsManifest.toml");
+    // Serial loading is kept for comparing load times and for debugging decoders
+    const bool parallel = m_AppContext.m_ConfigManager->getConfigValue<bool>(
+                    Assets::Configs::Window, "threading", "ParallelAssetLoading").value_or(true);
+
+    m_AppContext.m_ResourceManager->loadAssetsFromManifest(
+        "config/AssetsManifest.toml", parallel ? m_AppContext.m_ThreadPool.get() : nullptr);
+}
+
+void Application::initSimulation()
+{
+    auto& timing = m_AppContext.m_FrameTiming;
+    auto& config = *m_AppContext.m_ConfigManager;
+
+    unsigned int tickRate = config.getConfigValue<unsigned int>(
+                    Assets::Configs::Window, "simulation", "TickRate").value_or(60);
+    int maxCatchUpSteps = config.getConfigValue<int>(
+                    Assets::Configs::Window, "simulation", "MaxCatchUpSteps").value_or(5);
+
+    tickRate = std::clamp(tickRate, 1u, 1000u);
+    timing.fixedTimeStep = sf::seconds(1.0f / static_cast<float>(tickRate));
+    timing.maxCatchUpSteps = std::max(maxCatchUpSteps, 1);
+
+    int fastForwardBudgetMs = config.getConfigValue<int>(
+                    Assets::Configs::Window, "simulation", "FastForwardBudgetMs").value_or(12);
+    m_AppContext.m_TimeManager->setFastForwardBudget(sf::milliseconds(fastForwardBudgetMs));
+    m_AppContext.m_TimerManager->setTickDuration(timing.fixedTimeStep);
+
+    logger::Info(std::format("Simulation: {} Hz fixed step, up to {} catch-up steps per frame.",
+                             tickRate, timing.maxCatchUpSteps));
+}
+
+void Application::initLatencyTracking()
+{
+    auto& config = *m_AppContext.m_ConfigManager;
+    auto& latency = *m_AppContext.m_LatencyTracker;
+
+    std::string statsFile = config.getConfigValue<std::string>(
+                    Assets::Configs::Window, "latency", "StatsFile").value_or("");
+    int reportSeconds = config.getConfigValue<int>(
+                    Assets::Configs::Window, "latency", "ReportSeconds").value_or(5);
+    m_ShowLatency = config.getConfigValue<bool>(
+                    Assets::Configs::Window, "latency", "Overlay").value_or(false);
+
+    if (!statsFile.empty())
+    {
+        // Each run is headed by the settings that affect latency, so runs can be compared
+        const auto& pacer = *m_AppContext.m_FramePacer;
+        std::string vsync = config.getConfigValue<std::string>(
+                        Assets::Configs::Window, "display", "VSync").value_or("off");
+        std::string label = std::format("VSync {}, pacer {}, {} Hz simulation", vsync,
+                                        pacer.getTargetRate() == 0
+                                            ? std::string("uncapped")
+                                            : std::format("{} FPS", pacer.getTargetRate()),
+                                        std::lround(1.0f / m_AppContext.m_FrameTiming
+                                                               .fixedTimeStep.asSeconds()));
+        latency.openReport(statsFile, std::chrono::seconds(std::max(reportSeconds, 1)), label);
+    }
+
+    if (auto* font = m_AppContext.m_ResourceManager->getResource<sf::Font>(Assets::Fonts::ScoreFont))
+    {
+        m_LatencyText.emplace(*font, "", 24);
+        m_LatencyText->setFillColor(sf::Color::Yellow);
+        m_LatencyText->setPosition({ 10.0f, 10.0f });
+    }
 }
 
 void Application::run()
@@ -73,69 +182,226 @@ void Application::run()
     }
 
     auto& mainClock = *m_AppContext.m_MainClock;
+    auto& timing = m_AppContext.m_FrameTiming;
+    auto& time = *m_AppContext.m_TimeManager;
+    auto& pacer = *m_AppContext.m_FramePacer;
+    sf::Time accumulator = sf::Time::Zero;
+
+    // Don't count asset loading as a missed frame
+    pacer.resync();
+    mainClock.restart();
 
     while (m_AppContext.m_MainWindow->isOpen())
     {
-        sf::Time deltaTime = mainClock.restart();
+        const sf::Time realFrameTime = mainClock.restart();
         m_StateManager.processPending();
         processEvents();
-        update(deltaTime);
+
+        const auto* currentState = m_StateManager.getCurrentState();
+        const TimeDomain domain = currentState ? currentState->getTimeDomain() : TimeDomain::UI;
+        timing.stepsThisFrame = 0;
+        timing.droppedTime = false;
+
+        if (time.isFastForward() && domain == TimeDomain::World)
+        {
+            // Ignore real time: simulate as many steps as the CPU budget allows
+            sf::Clock budgetClock;
+            do
+            {
+                if (!step(domain))
+                {
+                    break;
+                }
+            } while (budgetClock.getElapsedTime() < time.getFastForwardBudget());
+
+            accumulator = sf::Time::Zero;
+            timing.interpolationAlpha = 1.0f;
+        }
+        else
+        {
+            // Run the simulation in fixed steps so its behavior doesn't depend on the frame rate.
+            // The top state's time domain decides how fast virtual time flows.
+            accumulator += time.scale(domain, realFrameTime);
+            while (accumulator >= timing.fixedTimeStep
+                   && timing.stepsThisFrame < timing.maxCatchUpSteps)
+            {
+                accumulator -= timing.fixedTimeStep;
+                step(domain);
+            }
+
+            // After a hitch (window drag, breakpoint...) drop the backlog instead of
+            // simulating it all at once or spiralling further behind
+            timing.droppedTime = accumulator >= timing.fixedTimeStep;
+            if (timing.droppedTime)
+            {
+                accumulator %= timing.fixedTimeStep;
+            }
+
+            timing.interpolationAlpha = accumulator / timing.fixedTimeStep;
+        }
+
+        // Frame point 2: events the simulation raised during this frame's steps
+        m_AppContext.m_GlobalEventManager->dispatchQueued();
+
+        // Coroutine tasks resume once per rendered frame, after the simulation caught up
+        m_AppContext.m_TaskScheduler->update(time, realFrameTime);
+
+        time.recordFrame(realFrameTime, timing.fixedTimeStep * static_cast<std::int64_t>(
+                                                                    timing.stepsThisFrame));
         render();
+        pacer.waitForNextFrame();
     }
+
+    pacer.logStats();
+    m_AppContext.m_LatencyTracker->logStats();
+}
+
+void Application::connectEvents()
+{
+    // Connected once; the handlers look up the current state when an event arrives
+    auto& events = *m_AppContext.m_GlobalEventManager;
+    events.sink<sf::Event::KeyPressed>().connect<&Application::onKeyPressed>(*this);
+    events.sink<sf::Event::MouseButtonPressed>().connect<&Application::onMouseButtonPressed>(*this);
+    events.sink<sf::Event::Resized>().connect<&Application::onResized>(*this);
+    events.sink<sf::Event::MouseMoved>().connect<&Application::onMouseMoved>(*this);
+    events.sink<sf::Event::MouseLeft>().connect<&Application::onMouseLeft>(*this);
 }
 
 void Application::processEvents()
 {
-    auto& globalEvents = m_AppContext.m_GlobalEventManager->getEventHandles();
-    auto* currentState = m_StateManager.getCurrentState();
-    if (!currentState)
+    auto& events = *m_AppContext.m_GlobalEventManager;
+    auto& input = *m_AppContext.m_InputManager;
+
+    input.beginFrame();
+    // This frame's window events are delivered as they are polled, in OS order
+    events.pollWindowEvents(*m_AppContext.m_MainWindow);
+    // Frame point 1: anything queued since the last drain
+    events.dispatchQueued();
+    // Every step of this frame reads the same input snapshot
+    input.endFrame();
+}
+
+//$ ----- Window Event Handlers ----- //
+
+// The global handlers (GlobalEventManager) are connected to the same events
+
+void Application::onKeyPressed(const sf::Event::KeyPressed& event)
+{
+    if (m_AppContext.m_InputManager->isBound(Action::ToggleLatency, event.scancode))
     {
-        logger::Error("No current state; aborting processEvents().");
-        m_AppContext.m_MainWindow->handleEvents([](const sf::Event::Closed&) {});
-        return;
+        m_ShowLatency = !m_ShowLatency;
+        m_LatencyRefreshClock.reset();
     }
-    auto& stateEvents = currentState->getEventHandlers();
 
-    auto onKeyPressMerged = [&](const sf::Event::KeyPressed& event) {
-        // run global logic first
-        if (globalEvents.onGlobalKeyPress)
-        {
-            globalEvents.onGlobalKeyPress(event);
-        }
-        // then run state-specific
-        if (stateEvents.onKeyPress)
-        {
-            stateEvents.onKeyPress(event);
-        }
-    };
-    
-    auto onResized = [&](const sf::Event::Resized& event) {
-        sf::Vector2f targetSize = {m_AppContext.m_AppSettings.targetWidth, 
-                                    m_AppContext.m_AppSettings.targetHeight};
+    if (auto* currentState = m_StateManager.getCurrentState())
+    {
+        currentState->getEventHandlers().onKeyPress(event);
+    }
+}
+
+void Application::onMouseButtonPressed(const sf::Event::MouseButtonPressed& event)
+{
+    if (auto* currentState = m_StateManager.getCurrentState())
+    {
+        currentState->getEventHandlers().onMouseButtonPress(event);
+    }
+}
+
+void Application::onResized(const sf::Event::Resized& event)
+{
+    sf::Vector2f targetSize = {m_AppContext.m_AppSettings.targetWidth, 
+                                m_AppContext.m_AppSettings.targetHeight};
+
+    sf::View view(sf::FloatRect({0.0f, 0.0f}, targetSize));
+    utils::boxView(view, event.size.x, event.size.y);
+    m_AppContext.m_MainWindow->setView(view);
+
+    auto& registry = *m_AppContext.m_Registry;
+    if (auto* hoverTracker = registry.ctx().find<HoverTracker>())
+    {
+        hoverTracker->invalidate();
+    }
+    Layout::invalidateRoots(registry);
+}
+
+// Only the last position of the frame is kept; hit testing happens in uiHoverSystem
+void Application::onMouseMoved(const sf::Event::MouseMoved& event)
+{
+    if (auto* hoverTracker = m_AppContext.m_Registry->ctx().find<HoverTracker>())
+    {
+        hoverTracker->pointerMoved(event.position);
+    }
+}
+
+void Application::onMouseLeft(const sf::Event::MouseLeft&)
+{
+    if (auto* hoverTracker = m_AppContext.m_Registry->ctx().find<HoverTracker>())
+    {
+        hoverTracker->pointerLeft();
+    }
+}
 
-        sf::View view(sf::FloatRect({0.0f, 0.0f}, targetSize));
-        utils::boxView(view, event.size.x, event.size.y);
-        m_AppContext.m_MainWindow->setView(view);
-    };
+bool Application::step(TimeDomain domain)
+{
+    auto& timing = m_AppContext.m_FrameTiming;
+
+    // The first step after a poll is where that input takes effect (every step reads the
+    // frame's InputManager snapshot)
+    m_AppContext.m_LatencyTracker->stepStarted(utils::LatencyTracker::Clock::now());
+    update(timing.fixedTimeStep);
+    // Timers fire in one batch after the state's systems, before a queued state change
+    m_AppContext.m_TimerManager->advance(domain);
+    m_AppContext.m_TimeManager->advance(domain, timing.fixedTimeStep);
+    ++timing.stepsThisFrame;
 
-    m_AppContext.m_MainWindow->handleEvents(
-        globalEvents.onClose,
-        onKeyPressMerged,
-        stateEvents.onMouseButtonPress,
-        onResized
-    );
+    // A state change queued by this step applies before the next one
+    if (m_StateManager.hasPendingChanges())
+    {
+        m_StateManager.processPending();
+        return false;
+    }
+    return true;
 }
 
 void Application::update(sf::Time deltaTime)
 {
-	m_StateManager.update(deltaTime);
+    // Keep pre-step positions so render() can interpolate between the last two steps
+    CoreSystems::storePreviousPositions(*m_AppContext.m_Registry);
+    m_StateManager.update(deltaTime);
 }
 
 void Application::render()
 {
-    m_AppContext.m_MainWindow->clear(sf::Color::Black);
+    auto& window = *m_AppContext.m_MainWindow;
+    window.clear(sf::Color::Black);
 
     m_StateManager.render();
 
-    m_AppContext.m_MainWindow->display();
+    if (m_ShowLatency && m_LatencyText)
+    {
+        updateLatencyOverlay();
+        window.draw(*m_LatencyText);
+    }
+
+    window.display();
+    // With vsync the driver may block in display(), so stamp after it returns
+    m_AppContext.m_LatencyTracker->framePresented(utils::LatencyTracker::Clock::now());
+}
+
+void Application::updateLatencyOverlay()
+{
+    // The percentiles sort up to a thousand samples; a few refreshes per second is plenty
+    if (m_LatencyRefreshClock.isRunning()
+        && m_LatencyRefreshClock.getElapsedTime() < sf::milliseconds(250))
+    {
+        return;
+    }
+    m_LatencyRefreshClock.restart();
+
+    const utils::LatencyStats stats = m_AppContext.m_LatencyTracker->getStats();
+    m_LatencyText->setString(std::format(
+        "Input latency ({} frames)\np50 {:.1f} ms  p95 {:.1f} ms  p99 {:.1f} ms  max {:.1f} ms\n"
+        "poll->step {:.1f} ms  step->present {:.1f} ms",
+        stats.samples, stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs,
+        stats.meanPollToStepMs, stats.meanStepToPresentMs));
 }
@@ -0,0 +1,120 @@
+#include "ECS/AnimationSheet.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <toml++/toml.hpp>
+
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+
+bool AnimationSheet::loadFromFile(std::string_view filepath)
+{
+    toml::parse_result metadataFile = toml::parse_file(filepath);
+
+    if (!metadataFile)
+    {
+        logger::Error(std::format(
+            "Error parsing animation file --> {}", metadataFile.error().description()
+        ));
+        return false;
+    }
+
+    m_FrameSize.x = metadataFile["sheet"]["frameWidth"].value_or(0);
+    m_FrameSize.y = metadataFile["sheet"]["frameHeight"].value_or(0);
+    m_TextureID = metadataFile["sheet"]["texture"].value_or("");
+    m_WantsPixelMasks = metadataFile["sheet"]["pixelMasks"].value_or(false);
+    m_MaskAlphaThreshold = static_cast<std::uint8_t>(
+        std::clamp(metadataFile["sheet"]["maskAlphaThreshold"].value_or(0), 0, 254));
+
+    if (m_FrameSize.x <= 0 || m_FrameSize.y <= 0)
+    {
+        logger::Error(std::format("Animation file {} has no valid frame size.", filepath));
+        return false;
+    }
+
+    m_Clips.clear();
+    m_ClipNames.clear();
+    m_FrameRects.clear();
+    m_PixelMasks.clear();
+
+    auto* clips = metadataFile["clips"].as_array();
+    if (!clips)
+    {
+        logger::Error(std::format("Animation file {} has no [[clips]].", filepath));
+        return false;
+    }
+
+    for (const auto& item : *clips)
+    {
+        toml::node_view view(item);
+
+        std::string name = view["name"].value_or("");
+        int row = view["row"].value_or(-1);
+        int frames = view["frames"].value_or(0);
+        int durationMs = view["durationMs"].value_or(0);
+
+        if (name.empty() || row < 0 || frames <= 0
+            || frames > std::numeric_limits<std::uint8_t>::max())
+        {
+            logger::Warn(std::format("Skipping invalid clip \"{}\" in {}", name, filepath));
+            continue;
+        }
+        if (m_Clips.size() >= InvalidClip)
+        {
+            logger::Warn(std::format("Too many clips in {}. Ignoring the rest.", filepath));
+            break;
+        }
+
+        AnimationClip clip;
+        clip.firstFrame = static_cast<std::uint16_t>(m_FrameRects.size());
+        clip.frameCount = static_cast<std::uint8_t>(frames);
+        clip.timePerFrame = (static_cast<float>(durationMs) / 1000.0f) / static_cast<float>(frames);
+
+        // Precompute every frame rect of this clip (one row of the sheet)
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            m_FrameRects.push_back({ { frame * m_FrameSize.x, row * m_FrameSize.y }, m_FrameSize });
+        }
+
+        m_Clips.push_back(clip);
+        m_ClipNames.push_back(std::move(name));
+    }
+
+    return !m_Clips.empty();
+}
+
+ClipID AnimationSheet::findClip(std::string_view name) const
+{
+    for (std::size_t i = 0; i < m_ClipNames.size(); ++i)
+    {
+        if (m_ClipNames[i] == name)
+        {
+            return static_cast<ClipID>(i);
+        }
+    }
+
+    logger::Warn(std::format("Animation clip \"{}\" not found.", name));
+    return InvalidClip;
+}
+
+void AnimationSheet::buildPixelMasks(const sf::Image& image)
+{
+    m_PixelMasks.clear();
+    m_PixelMasks.resize(m_FrameRects.size() * 2);
+
+    for (std::size_t frame = 0; frame < m_FrameRects.size(); ++frame)
+    {
+        m_PixelMasks[frame * 2].build(image, m_FrameRects[frame], m_MaskAlphaThreshold, false);
+        m_PixelMasks[frame * 2 + 1].build(image, m_FrameRects[frame], m_MaskAlphaThreshold, true);
+    }
+
+    logger::Info(std::format("Built {} pixel masks for {}", m_PixelMasks.size(), m_TextureID));
+}
@@ -0,0 +1,199 @@
+#include "ECS/Collision.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+namespace Collision
+{
+    std::optional<Contact> boxBox(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        const float overlapX = std::min(a.position.x + a.size.x, b.position.x + b.size.x)
+                             - std::max(a.position.x, b.position.x);
+        const float overlapY = std::min(a.position.y + a.size.y, b.position.y + b.size.y)
+                             - std::max(a.position.y, b.position.y);
+        if (overlapX <= 0.0f || overlapY <= 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        // Separate along the axis of least penetration
+        const sf::Vector2f delta = b.getCenter() - a.getCenter();
+        Contact contact;
+        if (overlapX < overlapY)
+        {
+            contact.normal = { delta.x < 0.0f ? -1.0f : 1.0f, 0.0f };
+            contact.penetration = overlapX;
+        }
+        else
+        {
+            contact.normal = { 0.0f, delta.y < 0.0f ? -1.0f : 1.0f };
+            contact.penetration = overlapY;
+        }
+        return contact;
+    }
+
+    std::optional<Contact> circleCircle(sf::Vector2f centerA, float radiusA,
+                                        sf::Vector2f centerB, float radiusB)
+    {
+        const sf::Vector2f delta = centerB - centerA;
+        const float radii = radiusA + radiusB;
+        const float distanceSq = delta.lengthSquared();
+        if (distanceSq >= radii * radii)
+        {
+            return std::nullopt;
+        }
+
+        const float distance = std::sqrt(distanceSq);
+        Contact contact;
+        // Concentric circles: any direction works
+        contact.normal = distance > 0.0f ? delta / distance : sf::Vector2f{ 1.0f, 0.0f };
+        contact.penetration = radii - distance;
+        return contact;
+    }
+
+    std::optional<Contact> boxCircle(const sf::FloatRect& box, sf::Vector2f center, float radius)
+    {
+        const sf::Vector2f boxMax = box.position + box.size;
+        const sf::Vector2f closest = { std::clamp(center.x, box.position.x, boxMax.x),
+                                       std::clamp(center.y, box.position.y, boxMax.y) };
+        const sf::Vector2f delta = center - closest;
+        const float distanceSq = delta.lengthSquared();
+
+        if (distanceSq > 0.0f)
+        {
+            if (distanceSq >= radius * radius)
+            {
+                return std::nullopt;
+            }
+            const float distance = std::sqrt(distanceSq);
+            Contact contact;
+            contact.normal = delta / distance;
+            contact.penetration = radius - distance;
+            return contact;
+        }
+
+        // Center is inside the box: push out through the nearest face
+        const float toLeft = center.x - box.position.x;
+        const float toRight = boxMax.x - center.x;
+        const float toTop = center.y - box.position.y;
+        const float toBottom = boxMax.y - center.y;
+        const float nearest = std::min({ toLeft, toRight, toTop, toBottom });
+
+        Contact contact;
+        contact.penetration = nearest + radius;
+        if (nearest == toLeft)       contact.normal = { -1.0f, 0.0f };
+        else if (nearest == toRight) contact.normal = { 1.0f, 0.0f };
+        else if (nearest == toTop)   contact.normal = { 0.0f, -1.0f };
+        else                         contact.normal = { 0.0f, 1.0f };
+        return contact;
+    }
+
+    std::optional<Contact> sweptBoxBox(const sf::FloatRect& a, sf::Vector2f displacement,
+                                       const sf::FloatRect& b)
+    {
+        // Already overlapping at the start of the step
+        if (auto contact = boxBox(a, b))
+        {
+            contact->time = 0.0f;
+            return contact;
+        }
+
+        // Ray from a's center against b grown by a's half size (Minkowski sum)
+        const sf::Vector2f origin = a.getCenter();
+        const sf::Vector2f expandedMin = b.position - a.size / 2.0f;
+        const sf::Vector2f expandedMax = b.position + b.size + a.size / 2.0f;
+
+        float tEntry = -std::numeric_limits<float>::infinity();
+        float tExit = std::numeric_limits<float>::infinity();
+        sf::Vector2f normal{ 0.0f, 0.0f };
+
+        const float origins[2] = { origin.x, origin.y };
+        const float deltas[2] = { displacement.x, displacement.y };
+        const float mins[2] = { expandedMin.x, expandedMin.y };
+        const float maxs[2] = { expandedMax.x, expandedMax.y };
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (deltas[axis] == 0.0f)
+            {
+                if (origins[axis] <= mins[axis] || origins[axis] >= maxs[axis])
+                {
+                    return std::nullopt;
+                }
+                continue;
+            }
+
+            const float inv = 1.0f / deltas[axis];
+            float tNear = (mins[axis] - origins[axis]) * inv;
+            float tFar = (maxs[axis] - origins[axis]) * inv;
+            if (tNear > tFar)
+            {
+                std::swap(tNear, tFar);
+            }
+
+            if (tNear > tEntry)
+            {
+                tEntry = tNear;
+                normal = axis == 0 ? sf::Vector2f{ deltas[0] > 0.0f ? 1.0f : -1.0f, 0.0f }
+                                   : sf::Vector2f{ 0.0f, deltas[1] > 0.0f ? 1.0f : -1.0f };
+            }
+            tExit = std::min(tExit, tFar);
+        }
+
+        if (tEntry > tExit || tEntry < 0.0f || tEntry > 1.0f)
+        {
+            return std::nullopt;
+        }
+
+        Contact contact;
+        contact.normal = normal;
+        contact.time = tEntry;
+        return contact;
+    }
+
+    std::optional<Contact> sweptCircleCircle(sf::Vector2f centerA, float radiusA,
+                                             sf::Vector2f displacement,
+                                             sf::Vector2f centerB, float radiusB)
+    {
+        // Already overlapping at the start of the step
+        if (auto contact = circleCircle(centerA, radiusA, centerB, radiusB))
+        {
+            contact->time = 0.0f;
+            return contact;
+        }
+
+        // First t in [0, 1] with |offset + t * displacement| == radii
+        const sf::Vector2f offset = centerA - centerB;
+        const float radii = radiusA + radiusB;
+        const float a = displacement.lengthSquared();
+        const float b = 2.0f * offset.dot(displacement);
+        const float c = offset.lengthSquared() - radii * radii;
+        if (a == 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        const float discriminant = b * b - 4.0f * a * c;
+        if (discriminant < 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        const float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
+        if (t < 0.0f || t > 1.0f)
+        {
+            return std::nullopt;
+        }
+
+        // At first touch the centers are exactly 'radii' apart
+        Contact contact;
+        contact.normal = -(offset + displacement * t) / radii;
+        contact.time = t;
+        return contact;
+    }
+}
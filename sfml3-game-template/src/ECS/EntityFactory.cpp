@@ -6,16 +6,29 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <entt/entt.hpp>
 
+#include "ECS/Collision.hpp"
 #include "ECS/Components.hpp"
+#include "ECS/Hierarchy.hpp"
+#include "ECS/Layout.hpp"
+#include "ECS/SpriteBatch.hpp"
+#include "ECS/AnimationSheet.hpp"
+#include "Managers/EntityPoolManager.hpp"
 #include "Utilities/Utils.hpp"
 #include "Utilities/Logger.hpp"
 #include "AppContext.hpp"
 #include "AssetKeys.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
 #include <string>
+#include <string_view>
 #include <utility>
 
 // functions for the ECS system
@@ -33,6 +46,14 @@ namespace EntityFactory
             return entt::null;
         }
 
+        auto* sheet = context.m_ResourceManager->getResource<AnimationSheet>(
+                                                            Assets::Animations::Player);
+        if (sheet == nullptr)
+        {
+            logger::Error("Couldn't create Player because missing animation sheet.");
+            return entt::null;
+        }
+
         context.m_ConfigManager->loadConfig("player", "config/Player.toml");
         float moveSpeed = context.m_ConfigManager->getConfigValue<float>("player", "player", "movementSpeed").value_or(350.0f);
         float scaleFactor = context.m_ConfigManager->getConfigValue<float>("player", "player", "scaleFactor").value_or(3.0f);
@@ -47,46 +68,72 @@ namespace EntityFactory
 
         // Sprite stuff
         auto& spriteComp = registry.emplace<SpriteComponent>(playerEntity, sf::Sprite(*texture));
-        spriteComp.sprite.setTextureRect({ {0, 0}, {32, 32} }); // assumes 32x32 sprite size
+        spriteComp.sprite.setTextureRect(sheet->getFrameRect(0));
         spriteComp.sprite.setPosition(position);
         utils::centerOrigin(spriteComp.sprite);
+        registry.emplace<RenderInterpolation>(playerEntity, position);
 
         // Sprite scaling and padding stuff
         sf::Vector2f scaleVector = { scaleFactor, scaleFactor };
 
         registry.emplace<BaseScale>(playerEntity, scaleVector);
-        // Apply scaling BEFORE getSpritePadding()
+        // Apply scaling BEFORE addSpriteCollider() reads the padding
         spriteComp.sprite.setScale(scaleVector);
-        SpritePadding padding = utils::getSpritePadding(spriteComp.sprite);
 
+        // The collider's (scaled) padding is the visible body; the window confinement uses it too
+        const SpritePadding padding = addSpriteCollider(registry, playerEntity, ColliderShape::Box,
+                                                        CollisionLayers::Player).padding;
         registry.emplace<ConfineToWindow>(
             playerEntity,
-            padding.left * scaleFactor,
-            padding.right * scaleFactor,
-            padding.top * scaleFactor,
-            padding.bottom * scaleFactor
+            padding.left,
+            padding.right,
+            padding.top,
+            padding.bottom
         );
+        registry.emplace<PixelPerfect>(playerEntity);
+
+        // Animator stuff -- clips come from the shared sheet (resources/sprites/knight.toml),
+        // so the animator itself only holds a clip index, a frame and a timer
+        auto& locomotion = registry.emplace<LocomotionClips>(
+            playerEntity, sheet->findClip("idle"), sheet->findClip("walk"));
 
-        // Animator stuff
         auto& animator = registry.emplace<AnimatorComponent>(playerEntity);
-        
-        animator.currentAnimationName = "idle";
-        animator.currentFrame = 0;
-        animator.elapsedTime = sf::Time::Zero;
-        animator.frameSize = { 32, 32 };
-
-        // Define "idle" and "walk" for player
-        // (using Brackey's knight sprite sheet)
-        // the milliseconds will probably have to be adjusted
-        animator.animations["idle"] = { 0, 4, sf::milliseconds(400) };
-        animator.animations["walk"] = { 3, 8, sf::milliseconds(800) };
-
-        //registry.emplace<AnimatorComponent>(playerEntity, std::move(animator));
+        animator.sheet = sheet;
+        animator.clip = locomotion.idle;
+
+        // Findable through SpatialGrid queries (sprite is fully set up by now)
+        registry.emplace<SpatialProxy>(playerEntity, SpatialLayers::World);
+
         logger::Info("Player created.");
 
         return playerEntity;
     }
 
+    Collider& addSpriteCollider(entt::registry& registry, entt::entity entity, ColliderShape shape,
+                                std::uint32_t layer, std::uint32_t mask, bool isStatic)
+    {
+        Collider collider;
+        collider.shape = shape;
+        collider.layer = layer;
+        collider.mask = mask;
+        collider.isStatic = isStatic;
+
+        if (const auto* spriteComp = registry.try_get<SpriteComponent>(entity))
+        {
+            // getSpritePadding() works in texture pixels
+            const sf::Vector2f scale = spriteComp->sprite.getScale();
+            const SpritePadding padding = utils::getSpritePadding(spriteComp->sprite);
+            collider.padding = { padding.left * std::abs(scale.x), padding.right * std::abs(scale.x),
+                                 padding.top * std::abs(scale.y), padding.bottom * std::abs(scale.y) };
+        }
+        else
+        {
+            logger::Warn("addSpriteCollider: entity has no SpriteComponent; collider has no padding.");
+        }
+
+        return registry.emplace_or_replace<Collider>(entity, collider);
+    }
+
     entt::entity createRectangle(AppContext& context, 
                                 sf::Vector2f size,
                                 const sf::Color& color,
@@ -101,9 +148,126 @@ namespace EntityFactory
         return rectEntity;
     }
 
+    //$ --- Batched Sprites ---
+    entt::entity createSpriteBatch(AppContext& context, const sf::Texture& texture,
+                                   std::size_t reserveQuads)
+    {
+        auto& registry = *context.m_Registry;
+
+        auto batchEntity = registry.create();
+        auto& batch = registry.emplace<SpriteBatch>(batchEntity, texture);
+        batch.reserve(reserveQuads);
+
+        return batchEntity;
+    }
+
+    entt::entity createBatchedSprite(AppContext& context, entt::entity batchEntity,
+                                     const AnimationSheet& sheet, ClipID clip,
+                                     sf::Vector2f position, float scale, bool updateLOD)
+    {
+        auto& registry = *context.m_Registry;
+
+        auto* batch = registry.valid(batchEntity) ? registry.try_get<SpriteBatch>(batchEntity)
+                                                  : nullptr;
+        if (!batch || clip >= sheet.getClipCount())
+        {
+            logger::Error("Couldn't create batched sprite: invalid batch or clip.");
+            return entt::null;
+        }
+
+        sf::Vector2f size = sf::Vector2f(sheet.getFrameSize()) * scale;
+        sf::FloatRect bounds(position - size / 2.0f, size);
+
+        auto entity = registry.create();
+        std::uint32_t quad = batch->addQuad(bounds, sheet.getFrameRect(clip, 0));
+        registry.emplace<BatchedSprite>(entity, batchEntity, quad);
+
+        auto& animator = registry.emplace<AnimatorComponent>(entity);
+        animator.sheet = &sheet;
+        animator.clip = clip;
+
+        // Crowds of batched sprites are the main candidates for reduced update rates
+        if (updateLOD)
+        {
+            registry.emplace<UpdateLOD>(entity);
+        }
+
+        return entity;
+    }
+
+    //$ --- Pooled Entities ---
+    EntityPool& createPool(AppContext& context, std::string_view poolID,
+                           EntityPool::Builder builder, std::size_t prewarmCount)
+    {
+        return context.m_EntityPoolManager->createPool(poolID, std::move(builder), prewarmCount);
+    }
+
+    entt::entity acquirePooled(AppContext& context, std::string_view poolID,
+                               sf::Vector2f position)
+    {
+        auto* pool = context.m_EntityPoolManager->getPool(poolID);
+        if (!pool)
+        {
+            logger::Error(std::format("Couldn't acquire entity: pool \"{}\" not found.", poolID));
+            return entt::null;
+        }
+
+        auto entity = pool->acquire();
+        if (entity == entt::null)
+        {
+            return entt::null;
+        }
+
+        // Recycled entities keep their old state, so reset what every prefab shares
+        auto& registry = *context.m_Registry;
+        if (auto* spriteComp = registry.try_get<SpriteComponent>(entity))
+        {
+            spriteComp->sprite.setPosition(position);
+        }
+        if (auto* interpolation = registry.try_get<RenderInterpolation>(entity))
+        {
+            // Teleport, don't slide in from where the entity was parked
+            interpolation->previousPosition = position;
+        }
+        if (auto* rect = registry.try_get<RenderableRect>(entity))
+        {
+            rect->shape.setPosition(position);
+        }
+        if (auto* circle = registry.try_get<RenderableCircle>(entity))
+        {
+            circle->shape.setPosition(position);
+        }
+        if (auto* velocity = registry.try_get<Velocity>(entity))
+        {
+            velocity->value = { 0.0f, 0.0f };
+        }
+
+        return entity;
+    }
+
+    void releasePooled(AppContext& context, entt::entity entity)
+    {
+        auto& registry = *context.m_Registry;
+
+        auto* pooled = registry.valid(entity) ? registry.try_get<Pooled>(entity) : nullptr;
+        if (!pooled || !pooled->pool)
+        {
+            logger::Warn("releasePooled: entity isn't pooled. Destroying it instead.");
+            if (registry.valid(entity))
+            {
+                registry.destroy(entity);
+            }
+            return;
+        }
+
+        pooled->pool->release(entity);
+    }
+
     //$ ----- G/UI ----- //
     //$ --- GUI Helpers --- //
-    void positionLabelLeftOf(sf::Text& text, const sf::FloatRect& buttonRect, float padding = 10.0f)
+    // Returns the label's (world) position
+    sf::Vector2f positionLabelLeftOf(sf::Text& text, const sf::FloatRect& buttonRect,
+                                     float padding = 10.0f)
     {
         sf::FloatRect textBounds = text.getLocalBounds();
 
@@ -118,12 +282,14 @@ namespace EntityFactory
         position.y = buttonRect.position.y + (buttonRect.size.y / 2.0f);
 
         text.setPosition(position);
+
+        return position;
     }
     
     //$ --- GUI Entities --- //
     entt::entity createButton(AppContext& context, sf::Font& font,
                             const std::string& text, sf::Vector2f position,
-                            std::function<void()> action,
+                            UICallback action,
                             UITags tag, sf::Vector2f size)
     {
         auto& registry = *context.m_Registry;
@@ -155,12 +321,18 @@ namespace EntityFactory
         // Clickable component
         registry.emplace<UIAction>(buttonEntity, std::move(action));
 
+        // Hover colours fade instead of switching
+        registry.emplace<HoverBlend>(buttonEntity);
+
+        // Transform (so labels/children can follow the button)
+        Hierarchy::makeTransformable(registry, buttonEntity, position);
+
         return buttonEntity;
     }
 
     entt::entity createGUIButton(AppContext& context, sf::Texture& texture,
                                 sf::Vector2f position,
-                                std::function<void()> action, UITags tag)
+                                UICallback action, UITags tag)
     {
         auto& registry = *context.m_Registry;
         auto buttonEntity = registry.create();
@@ -180,6 +352,9 @@ namespace EntityFactory
         // Clickable component
         registry.emplace<UIAction>(buttonEntity, std::move(action));
 
+        // Transform (so labels/children can follow the button)
+        Hierarchy::makeTransformable(registry, buttonEntity, position);
+
         return buttonEntity;
     }
 
@@ -201,40 +376,80 @@ namespace EntityFactory
         labelText.text.setFillColor(color);
     
         // Position the label
-        positionLabelLeftOf(labelText.text, buttonBounds.rect);
+        sf::Vector2f labelPosition = positionLabelLeftOf(labelText.text, buttonBounds.rect);
+
+        // Make the label a child of the button so it follows it around
+        if (const auto* buttonWorld = registry.try_get<WorldTransform>(buttonEntity))
+        {
+            Hierarchy::attach(registry, labelEntity, buttonEntity,
+                              labelPosition - buttonWorld->position);
+        }
     
         return labelEntity;
     }
 
     entt::entity createLabeledButton(AppContext &context, sf::Texture &texture,
-                                sf::Vector2f position, std::function<void ()> action,
+                                sf::Vector2f position, UICallback action,
                                 sf::Font& font, UITags tag, const std::string& text,
                                 unsigned int size, const sf::Color& color)
     {
-        auto& registry = *context.m_Registry;
-        auto buttonEntity = registry.create();
-    
-        // Tag components
-        registry.emplace<UITagID>(buttonEntity, tag);
-        registry.emplace<GUIButtonTag>(buttonEntity);
-    
-        // Sprite component
-        sf::Sprite buttonSprite(texture);
-        buttonSprite.setPosition(position);
-        sf::FloatRect bounds = buttonSprite.getGlobalBounds();
-        registry.emplace<GUISprite>(buttonEntity, std::move(buttonSprite));
-    
-        // Button bounds component
-        auto& buttonBounds = registry.emplace<UIBounds>(buttonEntity, bounds);
-        registry.emplace<UIAction>(buttonEntity, std::move(action));
-    
-        // Label text
-        auto& labelText = registry.emplace<UIText>(buttonEntity, sf::Text(font, text, size));
-        labelText.text.setFillColor(color);
-    
-        // Position the label
-        positionLabelLeftOf(labelText.text, buttonBounds.rect);
+        // The label is its own child entity so it follows the button's transform
+        auto buttonEntity = createGUIButton(context, texture, position, std::move(action), tag);
+        auto labelEntity = createButtonLabel(context, buttonEntity, font, text, size, color, tag);
+
+        // The label lights up and fades with the button's hover (this overrides its colour)
+        context.m_Registry->emplace<UIHoverFromParent>(labelEntity);
+        context.m_Registry->emplace<HoverBlend>(buttonEntity);
     
         return buttonEntity;
     }
+
+    entt::entity createLayout(AppContext& context, const LayoutContainer& layout, UITags tag,
+                              entt::entity parent, LayoutAnchor anchor)
+    {
+        auto& registry = *context.m_Registry;
+        auto layoutEntity = registry.create();
+
+        // Tag component
+        registry.emplace<UITagID>(layoutEntity, tag);
+
+        // Placed by the next layout pass
+        Hierarchy::makeTransformable(registry, layoutEntity, { 0.0f, 0.0f });
+        registry.emplace<LayoutContainer>(layoutEntity, layout);
+
+        if (parent != entt::null)
+        {
+            Layout::add(registry, parent, layoutEntity, anchor);
+        }
+        else
+        {
+            registry.emplace<LayoutAnchor>(layoutEntity, anchor);
+        }
+
+        return layoutEntity;
+    }
+
+    entt::entity createBoundText(AppContext& context, sf::Font& font, const float& source,
+                                 sf::Vector2f position, UITags tag, unsigned int size,
+                                 const sf::Color& color, TextFormatter format)
+    {
+        auto& registry = *context.m_Registry;
+        auto textEntity = registry.create();
+
+        // Tag component
+        registry.emplace<UITagID>(textEntity, tag);
+
+        // Format the current value right away so the first frame isn't blank
+        std::array<char, 32> buffer{};
+        const std::size_t length = format(buffer, source);
+        auto& uiText = registry.emplace<UIText>(textEntity,
+            sf::Text(font, sf::String::fromUtf8(buffer.begin(), buffer.begin() + length), size));
+        utils::centerOrigin(uiText.text);
+        uiText.text.setPosition(position);
+        uiText.text.setFillColor(color);
+
+        registry.emplace<TextBinding>(textEntity, &source, format, source);
+
+        return textEntity;
+    }
 }
\ No newline at end of file
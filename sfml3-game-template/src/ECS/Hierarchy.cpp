@@ -0,0 +1,144 @@
+#include "ECS/Hierarchy.hpp"
+
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // Same priority as the transform sync: shape, then sprite, then text
+    sf::Vector2f drawableScale(const entt::registry& registry, entt::entity entity)
+    {
+        if (const auto* uiShape = registry.try_get<UIShape>(entity))
+        {
+            return uiShape->shape.getScale();
+        }
+        if (const auto* guiSprite = registry.try_get<GUISprite>(entity))
+        {
+            return guiSprite->sprite.getScale();
+        }
+        if (const auto* uiText = registry.try_get<UIText>(entity))
+        {
+            return uiText->text.getScale();
+        }
+        return { 1.0f, 1.0f };
+    }
+}
+
+namespace Hierarchy
+{
+    void makeTransformable(entt::registry& registry, entt::entity entity,
+                           sf::Vector2f position, sf::Vector2f scale)
+    {
+        if (registry.all_of<LocalTransform>(entity))
+        {
+            return;
+        }
+
+        // Keep the drawable's own scale; the world scale is applied on top of it
+        const sf::Vector2f ownScale = drawableScale(registry, entity);
+        if (ownScale != sf::Vector2f{ 1.0f, 1.0f } && !registry.all_of<BaseScale>(entity))
+        {
+            registry.emplace<BaseScale>(entity, ownScale);
+        }
+
+        registry.emplace<LocalTransform>(entity, position, scale);
+        registry.emplace<WorldTransform>(entity, position, scale);
+        registry.emplace_or_replace<TransformDirty>(entity);
+    }
+
+    void attach(entt::registry& registry, entt::entity child, entt::entity parent,
+                sf::Vector2f localPosition)
+    {
+        if (child == parent || !registry.valid(child) || !registry.valid(parent))
+        {
+            logger::Warn("Hierarchy::attach: invalid child/parent pair.");
+            return;
+        }
+
+        // Refuse to create a cycle (parent is somewhere below child)
+        for (auto* up = registry.try_get<Parent>(parent); up && registry.valid(up->entity);
+             up = registry.try_get<Parent>(up->entity))
+        {
+            if (up->entity == child)
+            {
+                logger::Warn("Hierarchy::attach: parent is a descendant of child. Not attaching.");
+                return;
+            }
+        }
+
+        // Re-parenting: unlink from the old parent first
+        if (registry.all_of<Parent>(child))
+        {
+            detach(registry, child);
+        }
+
+        if (!registry.all_of<LocalTransform>(parent))
+        {
+            logger::Warn("Hierarchy::attach: parent has no LocalTransform. Not attaching.");
+            return;
+        }
+        makeTransformable(registry, child, localPosition);
+
+        registry.emplace_or_replace<Parent>(child, parent);
+        registry.get_or_emplace<Children>(parent).entities.push_back(child);
+        registry.get<LocalTransform>(child).position = localPosition;
+
+        markDirty(registry, child);
+    }
+
+    void detach(entt::registry& registry, entt::entity child)
+    {
+        auto* parentComp = registry.try_get<Parent>(child);
+        if (!parentComp)
+        {
+            return;
+        }
+
+        if (registry.valid(parentComp->entity))
+        {
+            if (auto* children = registry.try_get<Children>(parentComp->entity))
+            {
+                std::erase(children->entities, child);
+            }
+        }
+        registry.remove<Parent>(child);
+
+        // Keep the child where it currently is on screen
+        if (auto* world = registry.try_get<WorldTransform>(child))
+        {
+            auto& local = registry.get<LocalTransform>(child);
+            local.position = world->position;
+            local.scale = world->scale;
+        }
+
+        markDirty(registry, child);
+    }
+
+    void setLocalPosition(entt::registry& registry, entt::entity entity, sf::Vector2f position)
+    {
+        if (auto* local = registry.try_get<LocalTransform>(entity))
+        {
+            local->position = position;
+            markDirty(registry, entity);
+        }
+    }
+
+    void setLocalScale(entt::registry& registry, entt::entity entity, sf::Vector2f scale)
+    {
+        if (auto* local = registry.try_get<LocalTransform>(entity))
+        {
+            local->scale = scale;
+            markDirty(registry, entity);
+        }
+    }
+
+    void markDirty(entt::registry& registry, entt::entity entity)
+    {
+        registry.emplace_or_replace<TransformDirty>(entity);
+    }
+}
@@ -0,0 +1,127 @@
+#include "ECS/HoverTracker.hpp"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "ECS/SpatialGrid.hpp"
+
+#include <algorithm>
+#include <utility>
+
+//$ ----- HoverTracker ----- //
+
+void HoverTracker::pointerMoved(sf::Vector2i pixel) noexcept
+{
+    if (m_PointerInside && m_Pointer == pixel)
+    {
+        return;
+    }
+
+    m_Pointer = pixel;
+    m_PointerInside = true;
+    m_Dirty = true;
+}
+
+void HoverTracker::pointerLeft() noexcept
+{
+    m_PointerInside = false;
+    m_Dirty = true;
+}
+
+void HoverTracker::update(entt::registry& registry, const sf::RenderWindow& window)
+{
+    if (!m_Dirty)
+    {
+        return;
+    }
+    m_Dirty = false;
+
+    m_Hits.clear();
+    auto* grid = registry.ctx().find<SpatialGrid>();
+    if (grid && m_PointerInside)
+    {
+        if (!m_Pointer)
+        {
+            // No move event yet (right after start-up): read the position once
+            m_Pointer = sf::Mouse::getPosition(window);
+        }
+
+        // Only the UI entities in the pointer's grid cell are tested
+        const sf::Vector2f point = window.mapPixelToCoords(*m_Pointer);
+        for (auto entity : grid->queryPoint(point, SpatialLayers::UI))
+        {
+            if (registry.all_of<UIBounds>(entity) && !registry.all_of<Inactive>(entity))
+            {
+                m_Hits.push_back(entity);
+            }
+        }
+    }
+
+    // Leave: hovered last time but not any more (destroyed entities took UIHover with them)
+    for (auto entity : m_Hovered)
+    {
+        if (registry.valid(entity) && std::find(m_Hits.begin(), m_Hits.end(), entity) == m_Hits.end())
+        {
+            registry.remove<UIHover>(entity);
+        }
+    }
+
+    // Enter
+    for (auto entity : m_Hits)
+    {
+        if (!registry.all_of<UIHover>(entity))
+        {
+            registry.emplace<UIHover>(entity);
+        }
+    }
+
+    std::swap(m_Hovered, m_Hits);
+}
+
+//$ ----- Signals ----- //
+
+namespace
+{
+    void onBoundsChanged(entt::registry& registry, [[maybe_unused]] entt::entity entity)
+    {
+        if (auto* tracker = registry.ctx().find<HoverTracker>())
+        {
+            tracker->invalidate();
+        }
+    }
+
+    // Inactive is also used by pooled world entities; only UI matters here
+    void onActivationChanged(entt::registry& registry, entt::entity entity)
+    {
+        if (registry.all_of<UIBounds>(entity))
+        {
+            onBoundsChanged(registry, entity);
+        }
+    }
+}
+
+namespace HoverTracking
+{
+    void connect(entt::registry& registry)
+    {
+        registry.ctx().insert_or_assign(HoverTracker{});
+
+        registry.on_construct<UIBounds>().connect<&onBoundsChanged>();
+        registry.on_update<UIBounds>().connect<&onBoundsChanged>();
+        registry.on_destroy<UIBounds>().connect<&onBoundsChanged>();
+        registry.on_construct<Inactive>().connect<&onActivationChanged>();
+        registry.on_destroy<Inactive>().connect<&onActivationChanged>();
+    }
+
+    void disconnect(entt::registry& registry)
+    {
+        registry.on_construct<UIBounds>().disconnect<&onBoundsChanged>();
+        registry.on_update<UIBounds>().disconnect<&onBoundsChanged>();
+        registry.on_destroy<UIBounds>().disconnect<&onBoundsChanged>();
+        registry.on_construct<Inactive>().disconnect<&onActivationChanged>();
+        registry.on_destroy<Inactive>().disconnect<&onActivationChanged>();
+    }
+}
@@ -0,0 +1,444 @@
+#include "ECS/Layout.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "ECS/Hierarchy.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    // Reused between passes (registry context)
+    struct LayoutScratch
+    {
+        std::vector<entt::entity> roots;
+    };
+
+    // Visible size of a leaf, and the offset from its bounds' center to its position
+    // (buttons are centered, GUI sprites have a top-left origin)
+    struct Footprint
+    {
+        sf::Vector2f size{ 0.0f, 0.0f };
+        sf::Vector2f pivot{ 0.0f, 0.0f };
+    };
+
+    template<typename Drawable>
+    Footprint footprintOf(const Drawable& drawable)
+    {
+        const sf::FloatRect bounds = drawable.getGlobalBounds();
+        return { bounds.size, drawable.getPosition() - bounds.getCenter() };
+    }
+
+    // Same priority as the transform sync: shape, then sprite, then text
+    Footprint leafFootprint(const entt::registry& registry, entt::entity entity)
+    {
+        if (const auto* uiShape = registry.try_get<UIShape>(entity))
+        {
+            return footprintOf(uiShape->shape);
+        }
+        if (const auto* guiSprite = registry.try_get<GUISprite>(entity))
+        {
+            return footprintOf(guiSprite->sprite);
+        }
+        if (const auto* uiText = registry.try_get<UIText>(entity))
+        {
+            return footprintOf(uiText->text);
+        }
+        return {};
+    }
+
+    bool isLaidOut(const entt::registry& registry, entt::entity child)
+    {
+        return registry.valid(child) && !registry.all_of<Inactive>(child);
+    }
+
+    // 0, 0.5 or 1 along each axis
+    sf::Vector2f anchorFactor(Anchor anchor)
+    {
+        const auto index = static_cast<int>(anchor);
+        return { static_cast<float>(index % 3) * 0.5f, static_cast<float>(index / 3) * 0.5f };
+    }
+
+    // Center of a 'size' box placed in 'area' at 'anchor'
+    sf::Vector2f anchoredCenter(sf::FloatRect area, sf::Vector2f size, Anchor anchor)
+    {
+        const sf::Vector2f factor = anchorFactor(anchor);
+        return { area.position.x + (area.size.x - size.x) * factor.x + size.x * 0.5f,
+                 area.position.y + (area.size.y - size.y) * factor.y + size.y * 0.5f };
+    }
+
+    sf::FloatRect contentArea(sf::FloatRect rect, const LayoutPadding& padding)
+    {
+        return { { rect.position.x + padding.left, rect.position.y + padding.top },
+                 { std::max(rect.size.x - padding.left - padding.right, 0.0f),
+                   std::max(rect.size.y - padding.top - padding.bottom, 0.0f) } };
+    }
+
+    sf::Vector2f measure(entt::registry& registry, entt::entity entity);
+
+    // Leaves are read fresh (cheap). Containers use their cached size, unless they're dirty
+    // and 'remeasure' is set (the measure pass).
+    sf::Vector2f childSize(entt::registry& registry, entt::entity child, bool remeasure)
+    {
+        if (registry.all_of<LayoutContainer>(child))
+        {
+            const auto* box = registry.try_get<LayoutBox>(child);
+            if (box && !(remeasure && registry.all_of<LayoutDirty>(child)))
+            {
+                return box->rect.size;
+            }
+            return measure(registry, child);
+        }
+
+        const sf::Vector2f size = leafFootprint(registry, child).size;
+        registry.get_or_emplace<LayoutBox>(child).rect.size = size;
+        return size;
+    }
+
+    // Size of the children's block, without padding
+    sf::Vector2f contentSize(entt::registry& registry, entt::entity entity, bool remeasure)
+    {
+        const auto* children = registry.try_get<Children>(entity);
+        if (!children)
+        {
+            return { 0.0f, 0.0f };
+        }
+
+        const LayoutContainer container = registry.get<LayoutContainer>(entity);
+        sf::Vector2f content{ 0.0f, 0.0f };
+        int count = 0;
+        for (std::size_t i = 0; i < children->entities.size(); ++i)
+        {
+            const entt::entity child = children->entities[i];
+            if (!isLaidOut(registry, child))
+            {
+                continue;
+            }
+
+            const sf::Vector2f size = childSize(registry, child, remeasure);
+            switch (container.mode)
+            {
+                case LayoutMode::VerticalStack:
+                    content.x = std::max(content.x, size.x);
+                    content.y += size.y;
+                    break;
+                case LayoutMode::HorizontalStack:
+                    content.x += size.x;
+                    content.y = std::max(content.y, size.y);
+                    break;
+                case LayoutMode::Anchored:
+                    content.x = std::max(content.x, size.x);
+                    content.y = std::max(content.y, size.y);
+                    break;
+            }
+            ++count;
+        }
+
+        const float gaps = container.spacing * static_cast<float>(std::max(count - 1, 0));
+        if (container.mode == LayoutMode::VerticalStack)
+        {
+            content.y += gaps;
+        }
+        else if (container.mode == LayoutMode::HorizontalStack)
+        {
+            content.x += gaps;
+        }
+        return content;
+    }
+
+    sf::Vector2f measure(entt::registry& registry, entt::entity entity)
+    {
+        const sf::Vector2f content = contentSize(registry, entity, true);
+        const LayoutContainer& container = registry.get<LayoutContainer>(entity);
+        const LayoutPadding& padding = container.padding;
+
+        sf::Vector2f size{ content.x + padding.left + padding.right,
+                           content.y + padding.top + padding.bottom };
+        if (container.size.x > 0.0f)
+        {
+            size.x = container.size.x;
+        }
+        if (container.size.y > 0.0f)
+        {
+            size.y = container.size.y;
+        }
+
+        registry.get_or_emplace<LayoutBox>(entity).rect.size = size;
+        return size;
+    }
+
+    // Only touches the transform when the position really changed
+    void moveTo(entt::registry& registry, entt::entity entity, sf::Vector2f localPosition)
+    {
+        const auto* local = registry.try_get<LocalTransform>(entity);
+        if (!local)
+        {
+            return;
+        }
+
+        const sf::Vector2f delta = local->position - localPosition;
+        if (std::abs(delta.x) > 0.01f || std::abs(delta.y) > 0.01f)
+        {
+            Hierarchy::setLocalPosition(registry, entity, localPosition);
+        }
+    }
+
+    void arrange(entt::registry& registry, entt::entity entity, sf::FloatRect rect,
+                 sf::Vector2f parentOrigin);
+
+    void place(entt::registry& registry, entt::entity child, sf::Vector2f center,
+               sf::Vector2f size, sf::Vector2f origin)
+    {
+        const sf::FloatRect rect{ center - size * 0.5f, size };
+
+        if (registry.all_of<LayoutContainer>(child))
+        {
+            // A clean nested container that keeps its rect keeps its whole subtree
+            const auto* box = registry.try_get<LayoutBox>(child);
+            if (!box || box->rect != rect || registry.all_of<LayoutDirty>(child))
+            {
+                arrange(registry, child, rect, origin);
+            }
+            else
+            {
+                moveTo(registry, child, rect.getCenter() - origin);
+            }
+            return;
+        }
+
+        registry.get_or_emplace<LayoutBox>(child).rect = rect;
+        moveTo(registry, child, center + leafFootprint(registry, child).pivot - origin);
+    }
+
+    void arrange(entt::registry& registry, entt::entity entity, sf::FloatRect rect,
+                 sf::Vector2f parentOrigin)
+    {
+        // A container sits at the center of its rect; children are placed relative to it
+        registry.get_or_emplace<LayoutBox>(entity).rect = rect;
+        const sf::Vector2f origin = rect.getCenter();
+        moveTo(registry, entity, origin - parentOrigin);
+
+        const auto* children = registry.try_get<Children>(entity);
+        if (!children)
+        {
+            return;
+        }
+
+        const LayoutContainer container = registry.get<LayoutContainer>(entity);
+        const sf::FloatRect area = contentArea(rect, container.padding);
+        const sf::Vector2f content = contentSize(registry, entity, false);
+        const sf::Vector2f factor = anchorFactor(container.align);
+
+        // Top-left of the stacked block
+        sf::Vector2f cursor = anchoredCenter(area, content, container.align) - content * 0.5f;
+
+        for (std::size_t i = 0; i < children->entities.size(); ++i)
+        {
+            const entt::entity child = children->entities[i];
+            if (!isLaidOut(registry, child))
+            {
+                continue;
+            }
+
+            const sf::Vector2f size = childSize(registry, child, false);
+            sf::Vector2f center;
+            switch (container.mode)
+            {
+                case LayoutMode::VerticalStack:
+                    center = { area.position.x + (area.size.x - size.x) * factor.x + size.x * 0.5f,
+                               cursor.y + size.y * 0.5f };
+                    cursor.y += size.y + container.spacing;
+                    break;
+                case LayoutMode::HorizontalStack:
+                    center = { cursor.x + size.x * 0.5f,
+                               area.position.y + (area.size.y - size.y) * factor.y + size.y * 0.5f };
+                    cursor.x += size.x + container.spacing;
+                    break;
+                case LayoutMode::Anchored:
+                {
+                    const auto* anchor = registry.try_get<LayoutAnchor>(child);
+                    const LayoutAnchor placement = anchor ? *anchor : LayoutAnchor{};
+                    center = anchoredCenter(area, size, placement.anchor) + placement.offset;
+                    break;
+                }
+            }
+
+            place(registry, child, center, size, origin);
+        }
+    }
+
+    //$ ----- Signals ----- //
+
+    void onContainerConstructed(entt::registry& registry, entt::entity entity)
+    {
+        Layout::markDirty(registry, entity);
+    }
+
+    // Attach, re-parent, detach, destroy
+    void onParentChanged(entt::registry& registry, entt::entity entity)
+    {
+        const entt::entity parent = registry.get<Parent>(entity).entity;
+        if (registry.valid(parent))
+        {
+            Layout::markDirty(registry, parent);
+        }
+    }
+
+    // Moves don't matter (the layout does those), size changes do
+    void onBoundsUpdated(entt::registry& registry, entt::entity entity)
+    {
+        const auto* box = registry.try_get<LayoutBox>(entity);
+        if (!box || !registry.all_of<Parent>(entity))
+        {
+            return;
+        }
+
+        const sf::Vector2f size = registry.get<UIBounds>(entity).rect.size;
+        if (std::abs(size.x - box->rect.size.x) > 0.01f || std::abs(size.y - box->rect.size.y) > 0.01f)
+        {
+            onParentChanged(registry, entity);
+        }
+    }
+
+    void onActivationChanged(entt::registry& registry, entt::entity entity)
+    {
+        if (registry.all_of<LayoutBox, Parent>(entity))
+        {
+            onParentChanged(registry, entity);
+        }
+    }
+}
+
+namespace Layout
+{
+    void add(entt::registry& registry, entt::entity container, entt::entity child,
+             LayoutAnchor anchor)
+    {
+        if (!registry.all_of<LayoutContainer>(container))
+        {
+            logger::Warn("Layout::add: target is not a LayoutContainer. Not adding.");
+            return;
+        }
+
+        registry.emplace_or_replace<LayoutAnchor>(child, anchor);
+        // The next pass puts it in place (attach flags the container)
+        Hierarchy::attach(registry, child, container, { 0.0f, 0.0f });
+    }
+
+    void markDirty(entt::registry& registry, entt::entity entity)
+    {
+        entt::entity current = entity;
+        while (registry.valid(current))
+        {
+            if (registry.all_of<LayoutContainer>(current))
+            {
+                // Flags always go up to the root, so the rest is flagged already
+                if (registry.all_of<LayoutDirty>(current))
+                {
+                    return;
+                }
+                registry.emplace<LayoutDirty>(current);
+            }
+
+            const auto* parent = registry.try_get<Parent>(current);
+            if (!parent)
+            {
+                return;
+            }
+            current = parent->entity;
+        }
+    }
+
+    void invalidateRoots(entt::registry& registry)
+    {
+        auto view = registry.view<LayoutContainer>(entt::exclude<Parent>);
+        for (auto entity : view)
+        {
+            registry.emplace_or_replace<LayoutDirty>(entity);
+        }
+    }
+
+    void update(entt::registry& registry, sf::FloatRect viewArea)
+    {
+        auto& dirtyStorage = registry.storage<LayoutDirty>();
+        if (dirtyStorage.empty())
+        {
+            return;
+        }
+
+        // Dirty flags run up to the top container, so those are where the passes start
+        auto& scratch = registry.ctx().emplace<LayoutScratch>();
+        scratch.roots.clear();
+        for (auto entity : dirtyStorage)
+        {
+            const auto* parent = registry.try_get<Parent>(entity);
+            if (registry.all_of<LayoutContainer>(entity)
+                && (!parent || !registry.valid(parent->entity)
+                    || !registry.all_of<LayoutContainer>(parent->entity)))
+            {
+                scratch.roots.push_back(entity);
+            }
+        }
+
+        for (auto root : scratch.roots)
+        {
+            if (!isLaidOut(registry, root))
+            {
+                continue;
+            }
+
+            const sf::Vector2f measured = measure(registry, root);
+            const LayoutContainer& container = registry.get<LayoutContainer>(root);
+
+            // Fill the view along axes without a fixed size, then place by its anchor
+            const sf::Vector2f size{ container.size.x > 0.0f ? measured.x : viewArea.size.x,
+                                     container.size.y > 0.0f ? measured.y : viewArea.size.y };
+            const auto* anchor = registry.try_get<LayoutAnchor>(root);
+            const LayoutAnchor placement = anchor ? *anchor : LayoutAnchor{};
+            const sf::Vector2f center = anchoredCenter(viewArea, size, placement.anchor)
+                                      + placement.offset;
+
+            sf::Vector2f parentOrigin{ 0.0f, 0.0f };
+            if (const auto* parent = registry.try_get<Parent>(root); parent && registry.valid(parent->entity))
+            {
+                if (const auto* parentWorld = registry.try_get<WorldTransform>(parent->entity))
+                {
+                    parentOrigin = parentWorld->position;
+                }
+            }
+
+            arrange(registry, root, { center - size * 0.5f, size }, parentOrigin);
+        }
+
+        // Inactive subtrees were skipped; they're flagged again when reactivated
+        registry.clear<LayoutDirty>();
+    }
+
+    void connect(entt::registry& registry)
+    {
+        registry.on_construct<LayoutContainer>().connect<&onContainerConstructed>();
+        registry.on_construct<Parent>().connect<&onParentChanged>();
+        registry.on_update<Parent>().connect<&onParentChanged>();
+        registry.on_destroy<Parent>().connect<&onParentChanged>();
+        registry.on_update<UIBounds>().connect<&onBoundsUpdated>();
+        registry.on_construct<Inactive>().connect<&onActivationChanged>();
+        registry.on_destroy<Inactive>().connect<&onActivationChanged>();
+    }
+
+    void disconnect(entt::registry& registry)
+    {
+        registry.on_construct<LayoutContainer>().disconnect<&onContainerConstructed>();
+        registry.on_construct<Parent>().disconnect<&onParentChanged>();
+        registry.on_update<Parent>().disconnect<&onParentChanged>();
+        registry.on_destroy<Parent>().disconnect<&onParentChanged>();
+        registry.on_update<UIBounds>().disconnect<&onBoundsUpdated>();
+        registry.on_construct<Inactive>().disconnect<&onActivationChanged>();
+        registry.on_destroy<Inactive>().disconnect<&onActivationChanged>();
+    }
+}
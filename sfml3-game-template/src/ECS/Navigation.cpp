@@ -0,0 +1,335 @@
+#include "ECS/Navigation.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Collision.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <span>
+#include <utility>
+#include <vector>
+
+//$ ----- NavGrid ----- //
+
+NavGrid::NavGrid(sf::FloatRect worldBounds, float cellSize)
+{
+    reset(worldBounds, cellSize);
+}
+
+void NavGrid::reset(sf::FloatRect worldBounds, float cellSize)
+{
+    m_CellSize = std::max(cellSize, 1.0f);
+    m_Origin = worldBounds.position;
+    m_Size.x = std::max(static_cast<int>(std::ceil(worldBounds.size.x / m_CellSize)), 1);
+    m_Size.y = std::max(static_cast<int>(std::ceil(worldBounds.size.y / m_CellSize)), 1);
+
+    m_Costs = std::make_shared<std::vector<std::uint8_t>>(
+        static_cast<std::size_t>(m_Size.x) * m_Size.y, NavCost::Open);
+    ++m_Version;
+}
+
+std::vector<std::uint8_t>& NavGrid::editCosts()
+{
+    // A field job still holds the current array: give the main thread its own copy
+    if (m_Costs.use_count() > 1)
+    {
+        m_Costs = std::make_shared<std::vector<std::uint8_t>>(*m_Costs);
+    }
+    return *m_Costs;
+}
+
+void NavGrid::setCost(sf::Vector2i cell, std::uint8_t cost)
+{
+    if (!inBounds(cell) || (*m_Costs)[cellIndex(cell)] == cost)
+    {
+        return;
+    }
+
+    editCosts()[cellIndex(cell)] = cost;
+    ++m_Version;
+}
+
+void NavGrid::fillRect(sf::FloatRect worldRect, std::uint8_t cost)
+{
+    if (!overlapsWorld(worldRect))
+    {
+        return;
+    }
+
+    const sf::Vector2i first = worldToCell(worldRect.position);
+    const sf::Vector2i last = worldToCell(worldRect.position + worldRect.size);
+
+    bool changed = false;
+    for (int y = first.y; y <= last.y; ++y)
+    {
+        for (int x = first.x; x <= last.x; ++x)
+        {
+            const int index = cellIndex({ x, y });
+            if ((*m_Costs)[index] != cost)
+            {
+                editCosts()[index] = cost;
+                changed = true;
+            }
+        }
+    }
+
+    if (changed)
+    {
+        ++m_Version;
+    }
+}
+
+bool NavGrid::setCosts(std::span<const std::uint8_t> costs)
+{
+    if (costs.size() != m_Costs->size())
+    {
+        logger::Error(std::format("NavGrid::setCosts: expected {} cells, got {}.",
+                                  m_Costs->size(), costs.size()));
+        return false;
+    }
+
+    if (!std::equal(costs.begin(), costs.end(), m_Costs->begin()))
+    {
+        std::ranges::copy(costs, editCosts().begin());
+        ++m_Version;
+    }
+    return true;
+}
+
+void NavGrid::beginRebuild()
+{
+    m_Scratch.assign(m_Costs->size(), NavCost::Open);
+}
+
+void NavGrid::rebuildBlockRect(sf::FloatRect worldRect)
+{
+    if (m_Scratch.size() != m_Costs->size() || !overlapsWorld(worldRect))
+    {
+        return;
+    }
+
+    const sf::Vector2i first = worldToCell(worldRect.position);
+    const sf::Vector2i last = worldToCell(worldRect.position + worldRect.size);
+    for (int y = first.y; y <= last.y; ++y)
+    {
+        std::fill_n(m_Scratch.begin() + cellIndex({ first.x, y }), last.x - first.x + 1,
+                    NavCost::Blocked);
+    }
+}
+
+void NavGrid::commitRebuild()
+{
+    if (m_Scratch.size() != m_Costs->size() || m_Scratch == *m_Costs)
+    {
+        return;
+    }
+
+    if (m_Costs.use_count() > 1)
+    {
+        m_Costs = std::make_shared<std::vector<std::uint8_t>>(m_Scratch);
+    }
+    else
+    {
+        m_Costs->swap(m_Scratch);
+    }
+    ++m_Version;
+}
+
+std::uint8_t NavGrid::getCost(sf::Vector2i cell) const noexcept
+{
+    return inBounds(cell) ? (*m_Costs)[cellIndex(cell)] : NavCost::Blocked;
+}
+
+sf::Vector2i NavGrid::worldToCell(sf::Vector2f position) const noexcept
+{
+    const int x = static_cast<int>(std::floor((position.x - m_Origin.x) / m_CellSize));
+    const int y = static_cast<int>(std::floor((position.y - m_Origin.y) / m_CellSize));
+    return { std::clamp(x, 0, m_Size.x - 1), std::clamp(y, 0, m_Size.y - 1) };
+}
+
+sf::Vector2f NavGrid::cellCenter(sf::Vector2i cell) const noexcept
+{
+    return { m_Origin.x + (static_cast<float>(cell.x) + 0.5f) * m_CellSize,
+             m_Origin.y + (static_cast<float>(cell.y) + 0.5f) * m_CellSize };
+}
+
+bool NavGrid::overlapsWorld(sf::FloatRect worldRect) const noexcept
+{
+    const sf::FloatRect world{ m_Origin, sf::Vector2f(m_Size) * m_CellSize };
+    return worldRect.findIntersection(world).has_value();
+}
+
+bool NavGrid::inBounds(sf::Vector2i cell) const noexcept
+{
+    return cell.x >= 0 && cell.y >= 0 && cell.x < m_Size.x && cell.y < m_Size.y;
+}
+
+//$ ----- Navigation ----- //
+
+namespace
+{
+    struct Step
+    {
+        int dx;
+        int dy;
+        float length;
+    };
+
+    constexpr float Diagonal = 1.41421356f;
+    constexpr std::array<Step, 8> Steps{ {
+        { 1, 0, 1.0f }, { -1, 0, 1.0f }, { 0, 1, 1.0f }, { 0, -1, 1.0f },
+        { 1, 1, Diagonal }, { 1, -1, Diagonal }, { -1, 1, Diagonal }, { -1, -1, Diagonal },
+    } };
+
+    // Diagonal moves need both orthogonal neighbours open, so agents don't clip corners
+    bool canStep(const std::vector<std::uint8_t>& costs, sf::Vector2i size,
+                 int x, int y, const Step& step)
+    {
+        const int nx = x + step.dx;
+        const int ny = y + step.dy;
+        if (nx < 0 || ny < 0 || nx >= size.x || ny >= size.y
+            || costs[ny * size.x + nx] == NavCost::Blocked)
+        {
+            return false;
+        }
+        if (step.dx != 0 && step.dy != 0)
+        {
+            return costs[y * size.x + nx] != NavCost::Blocked
+                && costs[ny * size.x + x] != NavCost::Blocked;
+        }
+        return true;
+    }
+}
+
+namespace Navigation
+{
+    NavGrid& createGrid(entt::registry& registry, sf::FloatRect worldBounds, float cellSize)
+    {
+        registry.ctx().erase<NavigationCache>();
+        return registry.ctx().insert_or_assign(NavGrid{ worldBounds, cellSize });
+    }
+
+    void rebuildFromColliders(entt::registry& registry)
+    {
+        auto* grid = registry.ctx().find<NavGrid>();
+        const auto* world = registry.ctx().find<CollisionWorld>();
+        if (!grid || !world)
+        {
+            return;
+        }
+
+        grid->beginRebuild();
+        for (const auto& body : world->bodies)
+        {
+            if (body.isStatic && body.seen)
+            {
+                grid->rebuildBlockRect(body.box);
+            }
+        }
+        grid->commitRebuild();
+    }
+
+    std::shared_ptr<const FlowField> buildFlowField(
+        std::shared_ptr<const std::vector<std::uint8_t>> costs,
+        sf::Vector2i size, sf::Vector2i goal, std::uint64_t gridVersion)
+    {
+        auto field = std::make_shared<FlowField>();
+        field->size = size;
+        field->goal = goal;
+        field->gridVersion = gridVersion;
+
+        const std::size_t cellCount = static_cast<std::size_t>(size.x) * size.y;
+        field->distance.assign(cellCount, -1.0f);
+        field->directions.assign(cellCount, { 0.0f, 0.0f });
+
+        const auto& cost = *costs;
+        const int goalIndex = goal.y * size.x + goal.x;
+        if (cost[goalIndex] == NavCost::Blocked)
+        {
+            return field;
+        }
+
+        // Dijkstra outwards from the goal. Entering a cell costs its weight times the step length.
+        using Node = std::pair<float, int>;
+        std::priority_queue<Node, std::vector<Node>, std::greater<>> open;
+        field->distance[goalIndex] = 0.0f;
+        open.emplace(0.0f, goalIndex);
+
+        while (!open.empty())
+        {
+            const auto [distance, index] = open.top();
+            open.pop();
+            if (distance > field->distance[index])
+            {
+                continue; // Stale entry
+            }
+
+            const int x = index % size.x;
+            const int y = index / size.x;
+            for (const Step& step : Steps)
+            {
+                if (!canStep(cost, size, x, y, step))
+                {
+                    continue;
+                }
+
+                const int next = (y + step.dy) * size.x + (x + step.dx);
+                const float candidate = distance + step.length * static_cast<float>(cost[next]);
+                if (field->distance[next] < 0.0f || candidate < field->distance[next])
+                {
+                    field->distance[next] = candidate;
+                    open.emplace(candidate, next);
+                }
+            }
+        }
+
+        // Each reachable cell points at its cheapest neighbour
+        for (int y = 0; y < size.y; ++y)
+        {
+            for (int x = 0; x < size.x; ++x)
+            {
+                const int index = y * size.x + x;
+                if (index == goalIndex || field->distance[index] < 0.0f)
+                {
+                    continue;
+                }
+
+                float best = field->distance[index];
+                const Step* bestStep = nullptr;
+                for (const Step& step : Steps)
+                {
+                    if (!canStep(cost, size, x, y, step))
+                    {
+                        continue;
+                    }
+                    const float neighbour = field->distance[(y + step.dy) * size.x + (x + step.dx)];
+                    if (neighbour >= 0.0f && neighbour < best)
+                    {
+                        best = neighbour;
+                        bestStep = &step;
+                    }
+                }
+
+                if (bestStep)
+                {
+                    field->directions[index] = sf::Vector2f{ static_cast<float>(bestStep->dx),
+                                                             static_cast<float>(bestStep->dy) }
+                                               / bestStep->length;
+                }
+            }
+        }
+
+        return field;
+    }
+}
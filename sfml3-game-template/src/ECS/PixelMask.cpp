@@ -0,0 +1,287 @@
+#include "ECS/PixelMask.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PIXELMASK_SSE2 1
+#endif
+
+//$ ----- PixelMask ----- //
+
+void PixelMask::build(const sf::Image& image, const sf::IntRect& rect,
+                      std::uint8_t alphaThreshold, bool flipX)
+{
+    const sf::Vector2u imageSize = image.getSize();
+    m_Width = std::max(0, std::min(rect.size.x, static_cast<int>(imageSize.x) - rect.position.x));
+    m_Height = std::max(0, std::min(rect.size.y, static_cast<int>(imageSize.y) - rect.position.y));
+    m_WordsPerRow = (m_Width + 63) / 64;
+    m_Bits.assign(static_cast<std::size_t>(m_WordsPerRow) * static_cast<std::size_t>(m_Height), 0);
+
+    if (rect.position.x < 0 || rect.position.y < 0)
+    {
+        m_Bits.clear();
+        return;
+    }
+
+    for (int y = 0; y < m_Height; ++y)
+    {
+        std::uint64_t* row = &m_Bits[static_cast<std::size_t>(y * m_WordsPerRow)];
+        for (int x = 0; x < m_Width; ++x)
+        {
+            const sf::Vector2u pixel = { static_cast<unsigned int>(rect.position.x + x),
+                                         static_cast<unsigned int>(rect.position.y + y) };
+            if (image.getPixel(pixel).a > alphaThreshold)
+            {
+                const int column = flipX ? (m_Width - 1 - x) : x;
+                row[column >> 6] |= std::uint64_t{ 1 } << (column & 63);
+            }
+        }
+    }
+}
+
+bool PixelMask::isSolid(int x, int y) const noexcept
+{
+    if (x < 0 || y < 0 || x >= m_Width || y >= m_Height)
+    {
+        return false;
+    }
+    return (m_Bits[static_cast<std::size_t>(y * m_WordsPerRow + (x >> 6))] >> (x & 63)) & 1u;
+}
+
+std::uint64_t PixelMask::extract(int y, int x) const noexcept
+{
+    if (y < 0 || y >= m_Height || x < 0 || x >= m_Width)
+    {
+        return 0;
+    }
+
+    const std::uint64_t* row = &m_Bits[static_cast<std::size_t>(y * m_WordsPerRow)];
+    const int word = x >> 6;
+    const int shift = x & 63;
+
+    std::uint64_t bits = row[word] >> shift;
+    if (shift != 0 && word + 1 < m_WordsPerRow)
+    {
+        bits |= row[word + 1] << (64 - shift);
+    }
+    return bits;
+}
+
+bool PixelMask::anyInRect(sf::IntRect rect) const noexcept
+{
+    const int x0 = std::max(rect.position.x, 0);
+    const int y0 = std::max(rect.position.y, 0);
+    const int x1 = std::min(rect.position.x + rect.size.x, m_Width);
+    const int y1 = std::min(rect.position.y + rect.size.y, m_Height);
+
+    for (int y = y0; y < y1; ++y)
+    {
+        for (int x = x0; x < x1; x += 64)
+        {
+            std::uint64_t bits = extract(y, x);
+            const int remaining = x1 - x;
+            if (remaining < 64)
+            {
+                bits &= (std::uint64_t{ 1 } << remaining) - 1;
+            }
+            if (bits != 0)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//$ ----- Overlap tests ----- //
+
+namespace
+{
+    constexpr float ScaleEpsilon = 1e-3f;
+
+    sf::Vector2f pixelSize(const PixelCollision::Placement& placement)
+    {
+        const sf::Vector2i size = placement.mask->getSize();
+        return { placement.bounds.size.x / static_cast<float>(size.x),
+                 placement.bounds.size.y / static_cast<float>(size.y) };
+    }
+
+    // Same pixel size: b is a whole number of pixels away from a, so rows line up
+    bool overlapAligned(const PixelMask& a, const PixelMask& b, int offsetX, int offsetY)
+    {
+        const sf::Vector2i sizeA = a.getSize();
+        const sf::Vector2i sizeB = b.getSize();
+
+        // Overlap in a's pixel coordinates
+        const int x0 = std::max(0, offsetX);
+        const int x1 = std::min(sizeA.x, offsetX + sizeB.x);
+        const int y0 = std::max(0, offsetY);
+        const int y1 = std::min(sizeA.y, offsetY + sizeB.y);
+        if (x0 >= x1 || y0 >= y1)
+        {
+            return false;
+        }
+
+        const int columns = x1 - x0;
+        for (int y = y0; y < y1; ++y)
+        {
+            const int yB = y - offsetY;
+            int column = 0;
+
+#ifdef PIXELMASK_SSE2
+            // 128 pixels per iteration
+            for (; column + 128 <= columns; column += 128)
+            {
+                const int xA = x0 + column;
+                const int xB = xA - offsetX;
+                const __m128i bitsA = _mm_set_epi64x(
+                    static_cast<long long>(a.extract(y, xA + 64)), static_cast<long long>(a.extract(y, xA)));
+                const __m128i bitsB = _mm_set_epi64x(
+                    static_cast<long long>(b.extract(yB, xB + 64)), static_cast<long long>(b.extract(yB, xB)));
+                const __m128i both = _mm_and_si128(bitsA, bitsB);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(both, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    return true;
+                }
+            }
+#endif
+            for (; column < columns; column += 64)
+            {
+                const int xA = x0 + column;
+                std::uint64_t both = a.extract(y, xA) & b.extract(yB, xA - offsetX);
+                const int remaining = columns - column;
+                if (remaining < 64)
+                {
+                    both &= (std::uint64_t{ 1 } << remaining) - 1;
+                }
+                if (both != 0)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Different pixel sizes: walk the solid pixels of 'fine' inside the overlap and look
+    // up the pixel of 'coarse' under each of them
+    bool overlapResampled(const PixelCollision::Placement& fine,
+                          const PixelCollision::Placement& coarse,
+                          const sf::FloatRect& overlapRect)
+    {
+        const sf::Vector2f finePixel = pixelSize(fine);
+        const sf::Vector2f coarsePixel = pixelSize(coarse);
+        const sf::Vector2i fineSize = fine.mask->getSize();
+
+        const int x0 = std::max(0, static_cast<int>(std::floor(
+            (overlapRect.position.x - fine.bounds.position.x) / finePixel.x)));
+        const int x1 = std::min(fineSize.x, static_cast<int>(std::ceil(
+            (overlapRect.position.x + overlapRect.size.x - fine.bounds.position.x) / finePixel.x)));
+        const int y0 = std::max(0, static_cast<int>(std::floor(
+            (overlapRect.position.y - fine.bounds.position.y) / finePixel.y)));
+        const int y1 = std::min(fineSize.y, static_cast<int>(std::ceil(
+            (overlapRect.position.y + overlapRect.size.y - fine.bounds.position.y) / finePixel.y)));
+
+        for (int y = y0; y < y1; ++y)
+        {
+            const float worldY = fine.bounds.position.y + (static_cast<float>(y) + 0.5f) * finePixel.y;
+            const int coarseY = static_cast<int>(std::floor(
+                (worldY - coarse.bounds.position.y) / coarsePixel.y));
+
+            for (int x = x0; x < x1; x += 64)
+            {
+                std::uint64_t bits = fine.mask->extract(y, x);
+                const int remaining = x1 - x;
+                if (remaining < 64)
+                {
+                    bits &= (std::uint64_t{ 1 } << remaining) - 1;
+                }
+
+                // Only solid pixels of the fine mask need a lookup
+                while (bits != 0)
+                {
+                    const int column = x + std::countr_zero(bits);
+                    bits &= bits - 1;
+
+                    const float worldX = fine.bounds.position.x
+                                       + (static_cast<float>(column) + 0.5f) * finePixel.x;
+                    const int coarseX = static_cast<int>(std::floor(
+                        (worldX - coarse.bounds.position.x) / coarsePixel.x));
+                    if (coarse.mask->isSolid(coarseX, coarseY))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+}
+
+namespace PixelCollision
+{
+    bool overlap(const Placement& a, const Placement& b)
+    {
+        if (!a.mask || !b.mask || a.mask->empty() || b.mask->empty())
+        {
+            return false;
+        }
+
+        const auto intersection = a.bounds.findIntersection(b.bounds);
+        if (!intersection)
+        {
+            return false;
+        }
+
+        const sf::Vector2f pixelA = pixelSize(a);
+        const sf::Vector2f pixelB = pixelSize(b);
+
+        if (std::abs(pixelA.x - pixelB.x) < ScaleEpsilon && std::abs(pixelA.y - pixelB.y) < ScaleEpsilon)
+        {
+            const int offsetX = static_cast<int>(std::lround(
+                (b.bounds.position.x - a.bounds.position.x) / pixelA.x));
+            const int offsetY = static_cast<int>(std::lround(
+                (b.bounds.position.y - a.bounds.position.y) / pixelA.y));
+            return overlapAligned(*a.mask, *b.mask, offsetX, offsetY);
+        }
+
+        // Sample at the finer resolution so thin details aren't skipped
+        const bool aIsFiner = pixelA.x * pixelA.y <= pixelB.x * pixelB.y;
+        return aIsFiner ? overlapResampled(a, b, *intersection)
+                        : overlapResampled(b, a, *intersection);
+    }
+
+    bool overlapRect(const Placement& a, const sf::FloatRect& rect)
+    {
+        if (!a.mask || a.mask->empty())
+        {
+            return false;
+        }
+
+        const auto intersection = a.bounds.findIntersection(rect);
+        if (!intersection)
+        {
+            return false;
+        }
+
+        const sf::Vector2f pixel = pixelSize(a);
+        const sf::Vector2f localMin = (intersection->position - a.bounds.position);
+        const sf::Vector2f localMax = localMin + intersection->size;
+
+        const int x0 = static_cast<int>(std::floor(localMin.x / pixel.x));
+        const int y0 = static_cast<int>(std::floor(localMin.y / pixel.y));
+        const int x1 = static_cast<int>(std::ceil(localMax.x / pixel.x));
+        const int y1 = static_cast<int>(std::ceil(localMax.y / pixel.y));
+
+        return a.mask->anyInRect(sf::IntRect({ x0, y0 }, { x1 - x0, y1 - y0 }));
+    }
+}
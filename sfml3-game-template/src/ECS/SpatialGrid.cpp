@@ -0,0 +1,496 @@
+#include "ECS/SpatialGrid.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    bool intersects(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        return a.position.x <= b.position.x + b.size.x && b.position.x <= a.position.x + a.size.x
+            && a.position.y <= b.position.y + b.size.y && b.position.y <= a.position.y + a.size.y;
+    }
+
+    // Entry distance (along the ray, in units of 'direction') to the box, if it's hit
+    std::optional<float> rayHit(sf::Vector2f origin, sf::Vector2f invDirection,
+                                const sf::FloatRect& box, float maxT)
+    {
+        float tMin = 0.0f;
+        float tMax = maxT;
+
+        const float origins[2] = { origin.x, origin.y };
+        const float invDirs[2] = { invDirection.x, invDirection.y };
+        const float mins[2] = { box.position.x, box.position.y };
+        const float maxs[2] = { box.position.x + box.size.x, box.position.y + box.size.y };
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (std::isinf(invDirs[axis]))
+            {
+                // Parallel to this slab: hit only if the origin is inside it
+                if (origins[axis] < mins[axis] || origins[axis] > maxs[axis])
+                {
+                    return std::nullopt;
+                }
+                continue;
+            }
+
+            float t1 = (mins[axis] - origins[axis]) * invDirs[axis];
+            float t2 = (maxs[axis] - origins[axis]) * invDirs[axis];
+            if (t1 > t2)
+            {
+                std::swap(t1, t2);
+            }
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return tMin;
+    }
+}
+
+//$ ----- SpatialGrid ----- //
+
+SpatialGrid::SpatialGrid(sf::FloatRect worldBounds, float cellSize)
+{
+    reset(worldBounds, cellSize);
+}
+
+void SpatialGrid::reset(sf::FloatRect worldBounds, float cellSize)
+{
+    m_WorldBounds = worldBounds;
+    m_CellSize = std::max(cellSize, 1.0f);
+    m_InvCellSize = 1.0f / m_CellSize;
+    m_Columns = std::max(1, static_cast<int>(std::ceil(worldBounds.size.x * m_InvCellSize)));
+    m_Rows = std::max(1, static_cast<int>(std::ceil(worldBounds.size.y * m_InvCellSize)));
+
+    m_Cells.assign(static_cast<std::size_t>(m_Columns) * static_cast<std::size_t>(m_Rows), {});
+    m_Entries.clear();
+    m_Size = 0;
+}
+
+int SpatialGrid::cellX(float x) const noexcept
+{
+    const int column = static_cast<int>(std::floor((x - m_WorldBounds.position.x) * m_InvCellSize));
+    return std::clamp(column, 0, m_Columns - 1);
+}
+
+int SpatialGrid::cellY(float y) const noexcept
+{
+    const int row = static_cast<int>(std::floor((y - m_WorldBounds.position.y) * m_InvCellSize));
+    return std::clamp(row, 0, m_Rows - 1);
+}
+
+SpatialGrid::CellRange SpatialGrid::cellRange(sf::FloatRect bounds) const noexcept
+{
+    return { cellX(bounds.position.x), cellY(bounds.position.y),
+             cellX(bounds.position.x + bounds.size.x), cellY(bounds.position.y + bounds.size.y) };
+}
+
+void SpatialGrid::addToCells(entt::entity entity, const CellRange& range)
+{
+    for (int y = range.minY; y <= range.maxY; ++y)
+    {
+        for (int x = range.minX; x <= range.maxX; ++x)
+        {
+            cell(x, y).push_back(entity);
+        }
+    }
+}
+
+void SpatialGrid::removeFromCells(entt::entity entity, const CellRange& range)
+{
+    for (int y = range.minY; y <= range.maxY; ++y)
+    {
+        for (int x = range.minX; x <= range.maxX; ++x)
+        {
+            auto& entities = cell(x, y);
+            auto it = std::find(entities.begin(), entities.end(), entity);
+            if (it != entities.end())
+            {
+                // Order inside a cell doesn't matter
+                *it = entities.back();
+                entities.pop_back();
+            }
+        }
+    }
+}
+
+SpatialGrid::Entry* SpatialGrid::findEntry(entt::entity entity) noexcept
+{
+    const auto index = static_cast<std::size_t>(entt::to_entity(entity));
+    if (index >= m_Entries.size() || m_Entries[index].entity != entity)
+    {
+        return nullptr;
+    }
+    return &m_Entries[index];
+}
+
+const SpatialGrid::Entry* SpatialGrid::findEntry(entt::entity entity) const noexcept
+{
+    const auto index = static_cast<std::size_t>(entt::to_entity(entity));
+    if (index >= m_Entries.size() || m_Entries[index].entity != entity)
+    {
+        return nullptr;
+    }
+    return &m_Entries[index];
+}
+
+bool SpatialGrid::contains(entt::entity entity) const noexcept
+{
+    return findEntry(entity) != nullptr;
+}
+
+void SpatialGrid::update(entt::entity entity, sf::FloatRect bounds, std::uint32_t layers)
+{
+    if (entity == entt::null)
+    {
+        return;
+    }
+
+    const CellRange range = cellRange(bounds);
+
+    if (Entry* entry = findEntry(entity))
+    {
+        entry->bounds = bounds;
+
+        // Most moves stay inside the same cells: nothing else to do
+        if (entry->cells != range)
+        {
+            removeFromCells(entity, entry->cells);
+            addToCells(entity, range);
+            entry->cells = range;
+        }
+        return;
+    }
+
+    const auto index = static_cast<std::size_t>(entt::to_entity(entity));
+    if (index >= m_Entries.size())
+    {
+        m_Entries.resize(index + 1);
+    }
+
+    Entry& entry = m_Entries[index];
+    if (entry.entity != entt::null)
+    {
+        // Stale entry left by an older version of this entity slot
+        removeFromCells(entry.entity, entry.cells);
+        --m_Size;
+    }
+
+    entry.entity = entity;
+    entry.bounds = bounds;
+    entry.cells = range;
+    entry.layers = layers;
+    entry.stamp = 0;
+    addToCells(entity, range);
+    ++m_Size;
+}
+
+void SpatialGrid::remove(entt::entity entity)
+{
+    Entry* entry = findEntry(entity);
+    if (!entry)
+    {
+        return;
+    }
+
+    removeFromCells(entity, entry->cells);
+    *entry = {};
+    --m_Size;
+}
+
+std::uint32_t SpatialGrid::nextStamp()
+{
+    if (++m_Stamp == 0)
+    {
+        // Wrapped around: clear old stamps so they can't match by accident
+        for (auto& entry : m_Entries)
+        {
+            entry.stamp = 0;
+        }
+        m_Stamp = 1;
+    }
+    return m_Stamp;
+}
+
+std::span<const entt::entity> SpatialGrid::queryRect(sf::FloatRect rect, std::uint32_t layers)
+{
+    m_Results.clear();
+    const std::uint32_t stamp = nextStamp();
+    const CellRange range = cellRange(rect);
+
+    for (int y = range.minY; y <= range.maxY; ++y)
+    {
+        for (int x = range.minX; x <= range.maxX; ++x)
+        {
+            for (auto entity : cell(x, y))
+            {
+                Entry& entry = m_Entries[static_cast<std::size_t>(entt::to_entity(entity))];
+                if (entry.stamp == stamp)
+                {
+                    continue;
+                }
+                entry.stamp = stamp;
+
+                if ((entry.layers & layers) != 0 && intersects(entry.bounds, rect))
+                {
+                    m_Results.push_back(entity);
+                }
+            }
+        }
+    }
+
+    return m_Results;
+}
+
+std::span<const entt::entity> SpatialGrid::queryRadius(sf::Vector2f center, float radius,
+                                                       std::uint32_t layers)
+{
+    const sf::FloatRect circleBounds({ center.x - radius, center.y - radius },
+                                     { radius * 2.0f, radius * 2.0f });
+    queryRect(circleBounds, layers);
+
+    // Narrow the box candidates down to boxes that actually touch the circle
+    const float radiusSq = radius * radius;
+    std::erase_if(m_Results, [&](entt::entity entity) {
+        const sf::FloatRect& bounds = m_Entries[static_cast<std::size_t>(entt::to_entity(entity))].bounds;
+        const sf::Vector2f closest = {
+            std::clamp(center.x, bounds.position.x, bounds.position.x + bounds.size.x),
+            std::clamp(center.y, bounds.position.y, bounds.position.y + bounds.size.y)
+        };
+        return (center - closest).lengthSquared() > radiusSq;
+    });
+
+    return m_Results;
+}
+
+std::span<const entt::entity> SpatialGrid::queryPoint(sf::Vector2f point, std::uint32_t layers)
+{
+    // A point lives in exactly one cell, so no deduplication is needed
+    m_Results.clear();
+    for (auto entity : cell(cellX(point.x), cellY(point.y)))
+    {
+        const Entry& entry = m_Entries[static_cast<std::size_t>(entt::to_entity(entity))];
+        if ((entry.layers & layers) != 0 && entry.bounds.contains(point))
+        {
+            m_Results.push_back(entity);
+        }
+    }
+
+    return m_Results;
+}
+
+std::span<const entt::entity> SpatialGrid::queryRay(sf::Vector2f origin, sf::Vector2f direction,
+                                                    float maxDistance, std::uint32_t layers)
+{
+    m_Results.clear();
+    m_RayHits.clear();
+
+    const float length = direction.length();
+    if (length <= 0.0f || maxDistance <= 0.0f)
+    {
+        return m_Results;
+    }
+
+    const sf::Vector2f dir = direction / length;
+    const sf::Vector2f invDir = { dir.x != 0.0f ? 1.0f / dir.x : std::numeric_limits<float>::infinity(),
+                                  dir.y != 0.0f ? 1.0f / dir.y : std::numeric_limits<float>::infinity() };
+    const std::uint32_t stamp = nextStamp();
+
+    // Walk the cells the ray passes through (Amanatides & Woo DDA)
+    int x = cellX(origin.x);
+    int y = cellY(origin.y);
+    const int stepX = dir.x > 0.0f ? 1 : -1;
+    const int stepY = dir.y > 0.0f ? 1 : -1;
+
+    const float nextBoundaryX = m_WorldBounds.position.x
+                              + static_cast<float>(x + (stepX > 0 ? 1 : 0)) * m_CellSize;
+    const float nextBoundaryY = m_WorldBounds.position.y
+                              + static_cast<float>(y + (stepY > 0 ? 1 : 0)) * m_CellSize;
+
+    float tMaxX = std::isinf(invDir.x) ? maxDistance + 1.0f : (nextBoundaryX - origin.x) * invDir.x;
+    float tMaxY = std::isinf(invDir.y) ? maxDistance + 1.0f : (nextBoundaryY - origin.y) * invDir.y;
+    const float tDeltaX = std::isinf(invDir.x) ? 0.0f : m_CellSize * std::abs(invDir.x);
+    const float tDeltaY = std::isinf(invDir.y) ? 0.0f : m_CellSize * std::abs(invDir.y);
+
+    // Origins outside the grid are clamped to the border cell, which can make the first
+    // boundary lie behind the origin
+    tMaxX = std::max(tMaxX, 0.0f);
+    tMaxY = std::max(tMaxY, 0.0f);
+
+    while (true)
+    {
+        for (auto entity : cell(x, y))
+        {
+            Entry& entry = m_Entries[static_cast<std::size_t>(entt::to_entity(entity))];
+            if (entry.stamp == stamp)
+            {
+                continue;
+            }
+            entry.stamp = stamp;
+
+            if ((entry.layers & layers) == 0)
+            {
+                continue;
+            }
+            if (auto t = rayHit(origin, invDir, entry.bounds, maxDistance))
+            {
+                m_RayHits.emplace_back(*t, entity);
+            }
+        }
+
+        // Step into the next cell along whichever boundary is closer
+        if (tMaxX < tMaxY)
+        {
+            if (tMaxX > maxDistance)
+            {
+                break;
+            }
+            x += stepX;
+            tMaxX += tDeltaX;
+        }
+        else
+        {
+            if (tMaxY > maxDistance)
+            {
+                break;
+            }
+            y += stepY;
+            tMaxY += tDeltaY;
+        }
+
+        if (x < 0 || x >= m_Columns || y < 0 || y >= m_Rows)
+        {
+            break;
+        }
+    }
+
+    std::sort(m_RayHits.begin(), m_RayHits.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (const auto& hit : m_RayHits)
+    {
+        m_Results.push_back(hit.second);
+    }
+
+    return m_Results;
+}
+
+//$ ----- Registry integration ----- //
+
+namespace
+{
+    void onProxyConstructed(entt::registry& registry, entt::entity entity)
+    {
+        SpatialIndex::refresh(registry, entity);
+    }
+
+    void onProxyDestroyed(entt::registry& registry, entt::entity entity)
+    {
+        if (auto* grid = registry.ctx().find<SpatialGrid>())
+        {
+            grid->remove(entity);
+        }
+    }
+
+    void onBoundsConstructed(entt::registry& registry, entt::entity entity)
+    {
+        if (!registry.all_of<SpatialProxy>(entity))
+        {
+            // The proxy's construct signal inserts it
+            registry.emplace<SpatialProxy>(entity, SpatialLayers::UI);
+            return;
+        }
+        SpatialIndex::refresh(registry, entity);
+    }
+
+    void onBoundsUpdated(entt::registry& registry, entt::entity entity)
+    {
+        if (registry.all_of<SpatialProxy>(entity))
+        {
+            SpatialIndex::refresh(registry, entity);
+        }
+    }
+
+    // Parked pooled entities leave the grid
+    void onDeactivated(entt::registry& registry, entt::entity entity)
+    {
+        onProxyDestroyed(registry, entity);
+    }
+
+    // And go back in as soon as they're handed out again. UI entities are never picked up
+    // by spatialIndexSystem, so this is their only way back. Inactive's destroy signal also
+    // fires while the entity itself is destroyed; that's harmless: without a proxy refresh()
+    // does nothing, and a proxy that's still there removes the entry when it goes.
+    void onReactivated(entt::registry& registry, entt::entity entity)
+    {
+        SpatialIndex::refresh(registry, entity);
+    }
+}
+
+namespace SpatialIndex
+{
+    void connect(entt::registry& registry, sf::FloatRect worldBounds, float cellSize)
+    {
+        registry.ctx().insert_or_assign(SpatialGrid(worldBounds, cellSize));
+
+        registry.on_construct<SpatialProxy>().connect<&onProxyConstructed>();
+        registry.on_destroy<SpatialProxy>().connect<&onProxyDestroyed>();
+        registry.on_construct<UIBounds>().connect<&onBoundsConstructed>();
+        registry.on_update<UIBounds>().connect<&onBoundsUpdated>();
+        registry.on_construct<Inactive>().connect<&onDeactivated>();
+        registry.on_destroy<Inactive>().connect<&onReactivated>();
+    }
+
+    void disconnect(entt::registry& registry)
+    {
+        registry.on_construct<SpatialProxy>().disconnect<&onProxyConstructed>();
+        registry.on_destroy<SpatialProxy>().disconnect<&onProxyDestroyed>();
+        registry.on_construct<UIBounds>().disconnect<&onBoundsConstructed>();
+        registry.on_update<UIBounds>().disconnect<&onBoundsUpdated>();
+        registry.on_construct<Inactive>().disconnect<&onDeactivated>();
+        registry.on_destroy<Inactive>().disconnect<&onReactivated>();
+    }
+
+    void refresh(entt::registry& registry, entt::entity entity)
+    {
+        auto* grid = registry.ctx().find<SpatialGrid>();
+        const auto* proxy = registry.try_get<SpatialProxy>(entity);
+        if (!grid || !proxy)
+        {
+            return;
+        }
+
+        std::optional<sf::FloatRect> bounds;
+        if (const auto* uiBounds = registry.try_get<UIBounds>(entity))
+        {
+            bounds = uiBounds->rect;
+        }
+        else if (const auto* spriteComp = registry.try_get<SpriteComponent>(entity))
+        {
+            bounds = spriteComp->sprite.getGlobalBounds();
+        }
+
+        if (bounds)
+        {
+            grid->update(entity, *bounds, proxy->layers);
+        }
+    }
+}
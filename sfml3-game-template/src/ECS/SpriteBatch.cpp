@@ -0,0 +1,187 @@
+#include "ECS/SpriteBatch.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+SpriteBatch::SpriteBatch(const sf::Texture& texture)
+    : m_Texture(&texture)
+{
+}
+
+std::uint32_t SpriteBatch::addQuad(sf::FloatRect bounds, const sf::IntRect& textureRect)
+{
+    std::uint32_t quad = 0;
+    if (!m_FreeQuads.empty())
+    {
+        quad = m_FreeQuads.back();
+        m_FreeQuads.pop_back();
+    }
+    else
+    {
+        quad = static_cast<std::uint32_t>(getQuadCount());
+        m_Vertices.resize(m_Vertices.size() + VerticesPerQuad);
+    }
+
+    setQuadBounds(quad, bounds);
+    setTextureRect(quad, textureRect);
+    setQuadHidden(quad, false);
+
+    return quad;
+}
+
+void SpriteBatch::removeQuad(std::uint32_t quad)
+{
+    if (quad >= getQuadCount())
+    {
+        return;
+    }
+
+    // Zero-area triangles are skipped by the rasterizer
+    setQuadBounds(quad, {});
+    m_FreeQuads.push_back(quad);
+}
+
+void SpriteBatch::setQuadBounds(std::uint32_t quad, sf::FloatRect bounds)
+{
+    sf::Vertex* v = &m_Vertices[quad * VerticesPerQuad];
+
+    const sf::Vector2f topLeft = bounds.position;
+    const sf::Vector2f topRight = { bounds.position.x + bounds.size.x, bounds.position.y };
+    const sf::Vector2f bottomLeft = { bounds.position.x, bounds.position.y + bounds.size.y };
+    const sf::Vector2f bottomRight = bounds.position + bounds.size;
+
+    v[0].position = topLeft;
+    v[1].position = topRight;
+    v[2].position = bottomLeft;
+    v[3].position = bottomLeft;
+    v[4].position = topRight;
+    v[5].position = bottomRight;
+}
+
+void SpriteBatch::setQuadHidden(std::uint32_t quad, bool hidden)
+{
+    if (quad >= getQuadCount())
+    {
+        return;
+    }
+
+    const sf::Color color = hidden ? sf::Color::Transparent : sf::Color::White;
+    sf::Vertex* v = &m_Vertices[quad * VerticesPerQuad];
+    for (std::size_t i = 0; i < VerticesPerQuad; ++i)
+    {
+        v[i].color = color;
+    }
+}
+
+sf::Vector2f SpriteBatch::getQuadCenter(std::uint32_t quad) const
+{
+    const sf::Vertex* v = &m_Vertices[quad * VerticesPerQuad];
+
+    // Top-left and bottom-right corners
+    return (v[0].position + v[5].position) / 2.0f;
+}
+
+void SpriteBatch::setTextureRect(std::uint32_t quad, const sf::IntRect& textureRect)
+{
+    sf::Vertex* v = &m_Vertices[quad * VerticesPerQuad];
+
+    const float left = static_cast<float>(textureRect.position.x);
+    const float top = static_cast<float>(textureRect.position.y);
+    const float right = left + static_cast<float>(textureRect.size.x);
+    const float bottom = top + static_cast<float>(textureRect.size.y);
+
+    v[0].texCoords = { left, top };
+    v[1].texCoords = { right, top };
+    v[2].texCoords = { left, bottom };
+    v[3].texCoords = { left, bottom };
+    v[4].texCoords = { right, top };
+    v[5].texCoords = { right, bottom };
+}
+
+void SpriteBatch::reserve(std::size_t quadCount)
+{
+    m_Vertices.reserve(quadCount * VerticesPerQuad);
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (m_Vertices.empty())
+    {
+        return;
+    }
+
+    states.texture = m_Texture;
+    target.draw(m_Vertices.data(), m_Vertices.size(), sf::PrimitiveType::Triangles, states);
+}
+
+//$ ----- Signals ----- //
+
+namespace
+{
+    SpriteBatch* batchOf(entt::registry& registry, const BatchedSprite& batched)
+    {
+        return registry.valid(batched.batch) ? registry.try_get<SpriteBatch>(batched.batch)
+                                             : nullptr;
+    }
+
+    // Frees the quad of a destroyed batched sprite so its slot can be reused
+    void onBatchedSpriteDestroyed(entt::registry& registry, entt::entity entity)
+    {
+        const auto& batched = registry.get<BatchedSprite>(entity);
+        if (auto* batch = batchOf(registry, batched))
+        {
+            batch->removeQuad(batched.quad);
+        }
+    }
+
+    void onDeactivated(entt::registry& registry, entt::entity entity)
+    {
+        if (const auto* batched = registry.try_get<BatchedSprite>(entity))
+        {
+            if (auto* batch = batchOf(registry, *batched))
+            {
+                batch->setQuadHidden(batched->quad, true);
+            }
+        }
+    }
+
+    void onReactivated(entt::registry& registry, entt::entity entity)
+    {
+        if (const auto* batched = registry.try_get<BatchedSprite>(entity))
+        {
+            if (auto* batch = batchOf(registry, *batched))
+            {
+                batch->setQuadHidden(batched->quad, false);
+            }
+        }
+    }
+}
+
+namespace SpriteBatches
+{
+    void connect(entt::registry& registry)
+    {
+        registry.on_destroy<BatchedSprite>().connect<&onBatchedSpriteDestroyed>();
+        registry.on_construct<Inactive>().connect<&onDeactivated>();
+        registry.on_destroy<Inactive>().connect<&onReactivated>();
+    }
+
+    void disconnect(entt::registry& registry)
+    {
+        registry.on_destroy<BatchedSprite>().disconnect<&onBatchedSpriteDestroyed>();
+        registry.on_construct<Inactive>().disconnect<&onDeactivated>();
+        registry.on_destroy<Inactive>().disconnect<&onReactivated>();
+    }
+}
@@ -2,87 +2,428 @@
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/String.hpp>
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Utf.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
-#include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 #include <entt/entt.hpp>
 
+#include "ECS/Collision.hpp"
 #include "ECS/Components.hpp"
+#include "ECS/HoverTracker.hpp"
+#include "ECS/Layout.hpp"
+#include "ECS/Navigation.hpp"
+#include "ECS/PixelMask.hpp"
+#include "ECS/SpatialGrid.hpp"
+#include "ECS/SpriteBatch.hpp"
+#include "ECS/Tween.hpp"
+#include "Utilities/ThreadPool.hpp"
 #include "Utilities/Utils.hpp"
 #include "AppContext.hpp"
 #include "AssetKeys.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace
+{
+    // Reused between frames (lives in the registry context) so the hierarchy walk doesn't allocate
+    struct TransformScratch
+    {
+        std::vector<entt::entity> order;
+    };
+
+    // Frame counter used to stagger UpdateLOD ticks
+    struct UpdateLODClock
+    {
+        std::uint32_t frame{ 0 };
+    };
+
+    // Animators whose frame changed this update (reused between frames)
+    struct AnimationScratch
+    {
+        std::vector<entt::entity> changed;
+    };
+
+    // Pushes a resolved WorldTransform into the entity's drawables and refreshes UIBounds.
+    // The world scale is composed with the drawable's own scale (BaseScale).
+    void applyWorldTransform(entt::registry& registry, entt::entity entity,
+                             const WorldTransform& world)
+    {
+        std::optional<sf::FloatRect> bounds;
+
+        sf::Vector2f scale = world.scale;
+        if (const auto* baseScale = registry.try_get<BaseScale>(entity))
+        {
+            scale = scale.componentWiseMul(baseScale->value);
+        }
+
+        if (auto* uiShape = registry.try_get<UIShape>(entity))
+        {
+            uiShape->shape.setPosition(world.position);
+            uiShape->shape.setScale(scale);
+            bounds = uiShape->shape.getGlobalBounds();
+        }
+        if (auto* guiSprite = registry.try_get<GUISprite>(entity))
+        {
+            guiSprite->sprite.setPosition(world.position);
+            guiSprite->sprite.setScale(scale);
+            sf::FloatRect spriteBounds = guiSprite->sprite.getGlobalBounds();
+            if (!bounds)
+            {
+                bounds = spriteBounds;
+            }
+
+            // Overlay stays centered on its button
+            if (auto* redX = registry.try_get<GUIRedX>(entity))
+            {
+                redX->sprite.setPosition(spriteBounds.getCenter());
+            }
+        }
+        if (auto* uiText = registry.try_get<UIText>(entity))
+        {
+            uiText->text.setPosition(world.position);
+            uiText->text.setScale(scale);
+            if (!bounds)
+            {
+                bounds = uiText->text.getGlobalBounds();
+            }
+        }
+
+        if (bounds && registry.all_of<UIBounds>(entity))
+        {
+            registry.patch<UIBounds>(entity, [&](UIBounds& uiBounds) { uiBounds.rect = *bounds; });
+        }
+    }
+
+    // Collider shape in world space: sprite bounds minus padding (mirrored when flipped)
+    sf::FloatRect colliderBox(const Collider& collider, const sf::Sprite& sprite)
+    {
+        sf::FloatRect bounds = sprite.getGlobalBounds();
+        const bool isFlipped = sprite.getScale().x < 0.0f;
+        const float padLeft = isFlipped ? collider.padding.right : collider.padding.left;
+        const float padRight = isFlipped ? collider.padding.left : collider.padding.right;
+
+        bounds.position.x += padLeft;
+        bounds.position.y += collider.padding.top;
+        bounds.size.x = std::max(bounds.size.x - padLeft - padRight, 0.0f);
+        bounds.size.y = std::max(bounds.size.y - collider.padding.top - collider.padding.bottom, 0.0f);
+        return bounds;
+    }
+
+    void updateBody(CollisionWorld::Body& body, const Collider& collider,
+                    const sf::Sprite& sprite, bool isNew)
+    {
+        const sf::FloatRect box = colliderBox(collider, sprite);
+        body.displacement = isNew ? sf::Vector2f{ 0.0f, 0.0f } : box.getCenter() - body.box.getCenter();
+        body.box = box;
+
+        // Broad-phase extents cover the whole move so fast bodies still find their pairs
+        const sf::Vector2f start = box.position - body.displacement;
+        body.minX = std::min(box.position.x, start.x);
+        body.minY = std::min(box.position.y, start.y);
+        body.maxX = std::max(box.position.x, start.x) + box.size.x;
+        body.maxY = std::max(box.position.y, start.y) + box.size.y;
+
+        body.shape = collider.shape;
+        body.radius = collider.radius > 0.0f ? collider.radius
+                                             : std::min(box.size.x, box.size.y) / 2.0f;
+        body.layer = collider.layer;
+        body.mask = collider.mask;
+        body.isStatic = collider.isStatic;
+        body.seen = true;
+    }
+
+    // Current frame's mask of a PixelPerfect entity, placed at its sprite
+    std::optional<PixelCollision::Placement> maskPlacement(const entt::registry& registry,
+                                                           entt::entity entity)
+    {
+        const auto* animator = registry.try_get<AnimatorComponent>(entity);
+        const auto* spriteComp = registry.try_get<SpriteComponent>(entity);
+        if (!animator || !spriteComp || !animator->sheet
+            || animator->clip >= animator->sheet->getClipCount())
+        {
+            return std::nullopt;
+        }
+
+        const std::size_t frame = animator->sheet->getClip(animator->clip).firstFrame
+                                + animator->currentFrame;
+        const bool isFlipped = spriteComp->sprite.getScale().x < 0.0f;
+        const PixelMask* mask = animator->sheet->getPixelMask(frame, isFlipped);
+        if (!mask)
+        {
+            return std::nullopt;
+        }
+
+        return PixelCollision::Placement{ mask, spriteComp->sprite.getGlobalBounds() };
+    }
+
+    // Upper bound on the mask tests along one swept hit's path
+    constexpr int MaxSweptMaskSamples = 16;
+
+    // World size of one mask pixel (the smaller axis)
+    float maskPixelSize(const PixelCollision::Placement& placement)
+    {
+        const sf::Vector2i size = placement.mask->getSize();
+        return std::min(placement.bounds.size.x / static_cast<float>(std::max(size.x, 1)),
+                        placement.bounds.size.y / static_cast<float>(std::max(size.y, 1)));
+    }
+
+    // Mask test with both bodies moved back to where they were at 'time' in the step
+    bool pixelsOverlapAt(const std::optional<PixelCollision::Placement>& placementA,
+                         const std::optional<PixelCollision::Placement>& placementB,
+                         const CollisionWorld::Body& a, const CollisionWorld::Body& b,
+                         float time)
+    {
+        const sf::Vector2f offsetA = -a.displacement * (1.0f - time);
+        const sf::Vector2f offsetB = -b.displacement * (1.0f - time);
+
+        if (placementA && placementB)
+        {
+            PixelCollision::Placement movedA = *placementA;
+            PixelCollision::Placement movedB = *placementB;
+            movedA.bounds.position += offsetA;
+            movedB.bounds.position += offsetB;
+            return PixelCollision::overlap(movedA, movedB);
+        }
+        if (placementA)
+        {
+            PixelCollision::Placement movedA = *placementA;
+            movedA.bounds.position += offsetA;
+            return PixelCollision::overlapRect(movedA, { b.box.position + offsetB, b.box.size });
+        }
+
+        PixelCollision::Placement movedB = *placementB;
+        movedB.bounds.position += offsetB;
+        return PixelCollision::overlapRect(movedB, { a.box.position + offsetA, a.box.size });
+    }
+
+    // Runs only for pairs whose boxes already touch. A swept hit (time < 1) touches
+    // between step positions, and its end positions may already be past each other:
+    // the masks are tested from the time of impact to the end of the step, about one
+    // mask pixel of relative movement apart.
+    bool pixelsOverlap(const entt::registry& registry,
+                       const CollisionWorld::Body& a, const CollisionWorld::Body& b, float time)
+    {
+        const auto placementA = maskPlacement(registry, a.entity);
+        const auto placementB = maskPlacement(registry, b.entity);
+        if (!placementA && !placementB)
+        {
+            return true;
+        }
+
+        const float start = std::clamp(time, 0.0f, 1.0f);
+        if (start >= 1.0f)
+        {
+            return pixelsOverlapAt(placementA, placementB, a, b, 1.0f);
+        }
+
+        float pixel = std::numeric_limits<float>::max();
+        if (placementA)
+        {
+            pixel = std::min(pixel, maskPixelSize(*placementA));
+        }
+        if (placementB)
+        {
+            pixel = std::min(pixel, maskPixelSize(*placementB));
+        }
+
+        const float distance = (a.displacement - b.displacement).length() * (1.0f - start);
+        const float spacing = std::max(pixel, 0.5f);
+        const int samples = std::clamp(static_cast<int>(std::ceil(distance / spacing)),
+                                       1, MaxSweptMaskSamples);
+
+        for (int sample = 0; sample <= samples; ++sample)
+        {
+            const float sampleTime = start + (1.0f - start) * static_cast<float>(sample)
+                                                           / static_cast<float>(samples);
+            if (pixelsOverlapAt(placementA, placementB, a, b, sampleTime))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::uint64_t pairKey(entt::entity a, entt::entity b)
+    {
+        const std::uint64_t first = entt::to_integral(a);
+        const std::uint64_t second = entt::to_integral(b);
+        return first < second ? (second << 32) | first : (first << 32) | second;
+    }
+
+    std::optional<Contact> narrowPhase(const CollisionWorld::Body& a, const CollisionWorld::Body& b,
+                                       CollisionStats& stats)
+    {
+        // Fast relative motion: test the whole move, not just where the step ended
+        const sf::Vector2f relative = a.displacement - b.displacement;
+        const float minHalfExtent = std::min({ a.box.size.x, a.box.size.y,
+                                               b.box.size.x, b.box.size.y }) / 2.0f;
+        if (relative.lengthSquared() > minHalfExtent * minHalfExtent)
+        {
+            ++stats.sweptTests;
+            if (a.shape == ColliderShape::Circle && b.shape == ColliderShape::Circle)
+            {
+                return Collision::sweptCircleCircle(a.box.getCenter() - a.displacement, a.radius,
+                                                    relative,
+                                                    b.box.getCenter() - b.displacement, b.radius);
+            }
+
+            // Boxes, or a box and a circle's box (see Collision::sweptBoxBox)
+            sf::FloatRect startA = a.box;
+            sf::FloatRect startB = b.box;
+            startA.position -= a.displacement;
+            startB.position -= b.displacement;
+            return Collision::sweptBoxBox(startA, relative, startB);
+        }
+
+        const bool circleA = a.shape == ColliderShape::Circle;
+        const bool circleB = b.shape == ColliderShape::Circle;
+        if (!circleA && !circleB)
+        {
+            return Collision::boxBox(a.box, b.box);
+        }
+        if (circleA && circleB)
+        {
+            return Collision::circleCircle(a.box.getCenter(), a.radius, b.box.getCenter(), b.radius);
+        }
+        if (!circleA)
+        {
+            return Collision::boxCircle(a.box, b.box.getCenter(), b.radius);
+        }
+
+        // Circle vs box: the test's normal points box -> circle, contacts want a -> b
+        auto contact = Collision::boxCircle(b.box, a.box.getCenter(), a.radius);
+        if (contact)
+        {
+            contact->normal = -contact->normal;
+        }
+        return contact;
+    }
+
+    // Flow fields nobody asked for in this many steps are dropped
+    constexpr std::uint32_t FlowFieldIdleSteps = 600;
+
+    // Returns the goal's cached field (possibly from an older grid version) and queues a
+    // rebuild if it's missing or outdated. Null until the first build finishes.
+    const FlowField* requestFlowField(NavigationCache& cache, const NavGrid& grid,
+                                      utils::ThreadPool& pool, sf::Vector2i goalCell)
+    {
+        auto& entry = cache.fields[grid.cellIndex(goalCell)];
+        entry.lastUsedStep = cache.step;
+
+        const std::uint64_t version = grid.getVersion();
+        const bool current = entry.field && entry.field->gridVersion == version;
+        const bool queued = entry.pending.valid() && entry.pendingVersion == version;
+        if (!current && !queued)
+        {
+            // An older job still in flight is simply abandoned
+            entry.pending = pool.submit(
+                [costs = grid.getSnapshot(), size = grid.getSize(), goalCell, version]()
+                {
+                    return Navigation::buildFlowField(costs, size, goalCell, version);
+                });
+            entry.pendingVersion = version;
+        }
+
+        // A field from before a grid resize can't be sampled
+        if (entry.field && entry.field->size != grid.getSize())
+        {
+            return nullptr;
+        }
+        return entry.field.get();
+    }
+
+    // HoverBlend if the entity fades, otherwise 0/1 from UIHover
+    float hoverAmount(const entt::registry& registry, entt::entity entity)
+    {
+        if (const auto* blend = registry.try_get<HoverBlend>(entity))
+        {
+            return std::clamp(blend->value, 0.0f, 1.0f);
+        }
+        return registry.all_of<UIHover>(entity) ? 1.0f : 0.0f;
+    }
+
+    sf::Color lerpColor(sf::Color from, sf::Color to, float t)
+    {
+        auto channel = [t](std::uint8_t a, std::uint8_t b)
+        {
+            const float start = static_cast<float>(a);
+            return static_cast<std::uint8_t>(start + (static_cast<float>(b) - start) * t + 0.5f);
+        };
+        return { channel(from.r, to.r), channel(from.g, to.g),
+                 channel(from.b, to.b), channel(from.a, to.a) };
+    }
+}
+
 namespace CoreSystems
 {
     //$ "Core" / game systems (maybe rename...)
     void handlePlayerInput(AppContext& m_AppContext)
     {
         auto &registry = *m_AppContext.m_Registry;
-        auto &window = *m_AppContext.m_MainWindow;
+        const auto &input = *m_AppContext.m_InputManager;
 
         auto view = registry.view<PlayerTag,
                                 Velocity,
                                 MovementSpeed,
                                 AnimatorComponent,
+                                LocomotionClips,
                                 SpriteComponent,
-                                Facing>();
+                                Facing>(entt::exclude<Inactive>);
 
         for (auto entity : view)
         {
             auto& velocity = view.get<Velocity>(entity);
             const auto& speed = view.get<MovementSpeed>(entity);
             auto& animator = view.get<AnimatorComponent>(entity);
+            const auto& clips = view.get<LocomotionClips>(entity);
             auto& facing = view.get<Facing>(entity);
 
             // Reset velocity
             velocity.value = { 0.0f, 0.0f };
 
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::W))
+            if (input.isDown(Action::MoveUp))
             {
                 velocity.value.y -= speed.value;
             }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::S))
+            if (input.isDown(Action::MoveDown))
             {
                 velocity.value.y += speed.value;
             }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::A))
+            if (input.isDown(Action::MoveLeft))
             {
                 velocity.value.x -= speed.value;
                 facing.dir = FacingDirection::Left;
             }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::D))
+            if (input.isDown(Action::MoveRight))
             {
                 velocity.value.x += speed.value;
                 facing.dir = FacingDirection::Right;
             }
 
             //$ --- Animating the player sprite ---
-            // if player is walking
-            if (velocity.value.x != 0.0f || velocity.value.y != 0.0f)
-            {
-                // this prevents resetting the animation every frame
-                if (animator.currentAnimationName != "walk")
-                {
-                    animator.currentAnimationName = "walk";
-                    animator.currentFrame = 0;
-                    animator.elapsedTime = sf::Time::Zero;
-                }
-            }
-            else
-            {
-                if (animator.currentAnimationName != "idle")
-                {
-                    animator.currentAnimationName = "idle";
-                    animator.currentFrame = 0;
-                    animator.elapsedTime = sf::Time::Zero;
-                }
-            }
+            // play() only resets the animation when the clip actually changes
+            bool isWalking = velocity.value.x != 0.0f || velocity.value.y != 0.0f;
+            animator.play(isWalking ? clips.walk : clips.idle);
         }
     }
 
@@ -92,7 +433,7 @@ namespace CoreSystems
         auto windowSize = window.getView().getSize();
 
         // now moves anything with a sprite
-        auto view = registry.view<SpriteComponent, Velocity>();
+        auto view = registry.view<SpriteComponent, Velocity>(entt::exclude<Inactive>);
         for (auto entity : view)
         {
             auto& spriteComp = view.get<SpriteComponent>(entity);
@@ -152,7 +493,7 @@ namespace CoreSystems
 
     void facingSystem(entt::registry& registry)
     {
-        auto view = registry.view<SpriteComponent, Facing, BaseScale>();
+        auto view = registry.view<SpriteComponent, Facing, BaseScale>(entt::exclude<Inactive>);
 
         for (auto entity : view)
         {
@@ -172,18 +513,357 @@ namespace CoreSystems
         }
     }
 
-    void renderSystem(entt::registry& registry, sf::RenderWindow& window, bool showDebug)
+    void navigationSystem(entt::registry& registry, utils::ThreadPool& pool)
     {
+        const auto* grid = registry.ctx().find<NavGrid>();
+        if (!grid)
+        {
+            return;
+        }
+
+        auto& cache = registry.ctx().emplace<NavigationCache>();
+        ++cache.step;
+        cache.stats = {};
+
+        // Pick up finished jobs without waiting on the ones still running
+        for (auto& [goal, entry] : cache.fields)
+        {
+            if (entry.pending.valid()
+                && entry.pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                entry.field = entry.pending.get();
+                ++cache.stats.fieldsBuilt;
+            }
+        }
+
+        auto view = registry.view<NavAgent, Velocity, MovementSpeed, SpriteComponent>(
+            entt::exclude<Inactive>);
+        for (auto [entity, agent, velocity, speed, spriteComp] : view.each())
+        {
+            ++cache.stats.agents;
+
+            const sf::Vector2f position = spriteComp.sprite.getPosition();
+            const sf::Vector2f toGoal = agent.goal - position;
+            if (toGoal.lengthSquared() <= agent.arriveRadius * agent.arriveRadius)
+            {
+                agent.arrived = true;
+                velocity.value = { 0.0f, 0.0f };
+                continue;
+            }
+            agent.arrived = false;
+
+            const sf::Vector2i goalCell = grid->worldToCell(agent.goal);
+            const FlowField* field = requestFlowField(cache, *grid, pool, goalCell);
+            const int index = grid->cellIndex(grid->worldToCell(position));
+            if (!field || !field->reachable(index))
+            {
+                velocity.value = { 0.0f, 0.0f };
+                continue;
+            }
+
+            // Inside the goal cell the field has no direction left: head straight for the goal
+            const sf::Vector2f direction = field->directions[index];
+            velocity.value = direction == sf::Vector2f{ 0.0f, 0.0f }
+                                 ? toGoal.normalized() * speed.value
+                                 : direction * speed.value;
+        }
+
+        // Evict fields for goals nobody has followed in a while
+        std::erase_if(cache.fields, [&cache](const auto& item)
+        {
+            return cache.step - item.second.lastUsedStep > FlowFieldIdleSteps;
+        });
+
+        for (const auto& [goal, entry] : cache.fields)
+        {
+            cache.stats.cachedFields += entry.field ? 1 : 0;
+            cache.stats.pendingFields += entry.pending.valid() ? 1 : 0;
+        }
+    }
+
+    void transformSystem(entt::registry& registry)
+    {
+        auto& dirtyStorage = registry.storage<TransformDirty>();
+        if (dirtyStorage.empty())
+        {
+            return;
+        }
+
+        auto& scratch = registry.ctx().emplace<TransformScratch>();
+        scratch.order.clear();
+
+        // Collect the roots of the dirty subtrees (dirty entities without a dirty ancestor)
+        for (auto entity : dirtyStorage)
+        {
+            bool ancestorDirty = false;
+            for (auto* parent = registry.try_get<Parent>(entity);
+                 parent && registry.valid(parent->entity);
+                 parent = registry.try_get<Parent>(parent->entity))
+            {
+                if (dirtyStorage.contains(parent->entity))
+                {
+                    ancestorDirty = true;
+                    break;
+                }
+            }
+            if (!ancestorDirty)
+            {
+                scratch.order.push_back(entity);
+            }
+        }
+
+        // Breadth-first expansion. 'order' is both the queue and the processing list, so
+        // parents always resolve before their children and the update pass below is linear.
+        for (std::size_t head = 0; head < scratch.order.size(); ++head)
+        {
+            auto* children = registry.try_get<Children>(scratch.order[head]);
+            if (!children)
+            {
+                continue;
+            }
+
+            // Drop links to children that were destroyed
+            std::erase_if(children->entities, [&registry](entt::entity child) {
+                return !registry.valid(child);
+            });
+            scratch.order.insert(scratch.order.end(),
+                                 children->entities.begin(), children->entities.end());
+        }
+
+        for (auto entity : scratch.order)
+        {
+            auto* local = registry.try_get<LocalTransform>(entity);
+            auto* world = registry.try_get<WorldTransform>(entity);
+            if (!local || !world)
+            {
+                continue;
+            }
+
+            const WorldTransform* parentWorld = nullptr;
+            if (auto* parent = registry.try_get<Parent>(entity);
+                parent && registry.valid(parent->entity))
+            {
+                parentWorld = registry.try_get<WorldTransform>(parent->entity);
+            }
+
+            if (parentWorld)
+            {
+                world->position = parentWorld->position
+                                + parentWorld->scale.componentWiseMul(local->position);
+                world->scale = parentWorld->scale.componentWiseMul(local->scale);
+            }
+            else
+            {
+                world->position = local->position;
+                world->scale = local->scale;
+            }
+
+            applyWorldTransform(registry, entity, *world);
+        }
+
+        registry.clear<TransformDirty>();
+    }
+
+    void collisionSystem(entt::registry& registry)
+    {
+        auto& world = registry.ctx().emplace<CollisionWorld>();
+        world.stats = {};
+        world.contacts.clear();
+        world.ended.clear();
+        std::swap(world.pairs, world.previousPairs);
+        world.pairs.clear();
+
+        // Refresh the bodies we already track (their order is kept for the incremental sort)
+        const auto& inactive = registry.storage<Inactive>();
+        for (auto& body : world.bodies)
+        {
+            body.seen = false;
+            if (!registry.valid(body.entity) || inactive.contains(body.entity))
+            {
+                continue;
+            }
+
+            const auto* collider = registry.try_get<Collider>(body.entity);
+            const auto* spriteComp = registry.try_get<SpriteComponent>(body.entity);
+            if (collider && spriteComp)
+            {
+                updateBody(body, *collider, spriteComp->sprite, false);
+            }
+        }
+
+        // Drop bodies whose collider (or entity) went away
+        std::erase_if(world.bodies, [&](const CollisionWorld::Body& body) {
+            if (body.seen)
+            {
+                return false;
+            }
+            const auto index = static_cast<std::size_t>(entt::to_entity(body.entity));
+            if (index < world.members.size() && world.members[index] == body.entity)
+            {
+                world.members[index] = entt::null;
+            }
+            return true;
+        });
+
+        // Add new colliders at the end; the sort below moves them into place
+        auto view = registry.view<Collider, SpriteComponent>(entt::exclude<Inactive>);
+        for (auto [entity, collider, spriteComp] : view.each())
+        {
+            const auto index = static_cast<std::size_t>(entt::to_entity(entity));
+            if (index < world.members.size() && world.members[index] == entity)
+            {
+                continue;
+            }
+            if (index >= world.members.size())
+            {
+                world.members.resize(index + 1, entt::null);
+            }
+            world.members[index] = entity;
+
+            CollisionWorld::Body body;
+            body.entity = entity;
+            updateBody(body, collider, spriteComp.sprite, true);
+            world.bodies.push_back(body);
+        }
+
+        // Insertion sort on minX: nearly sorted from last step, so this is close to O(n)
+        auto& bodies = world.bodies;
+        for (std::size_t i = 1; i < bodies.size(); ++i)
+        {
+            CollisionWorld::Body key = bodies[i];
+            std::size_t j = i;
+            while (j > 0 && bodies[j - 1].minX > key.minX)
+            {
+                bodies[j] = bodies[j - 1];
+                --j;
+                ++world.stats.sortSwaps;
+            }
+            bodies[j] = key;
+        }
+
+        // Sweep: only bodies whose x intervals overlap are paired
+        const auto& pixelPerfect = registry.storage<PixelPerfect>();
+        for (std::size_t i = 0; i < bodies.size(); ++i)
+        {
+            const auto& a = bodies[i];
+            for (std::size_t j = i + 1; j < bodies.size() && bodies[j].minX <= a.maxX; ++j)
+            {
+                const auto& b = bodies[j];
+                if (b.maxY < a.minY || b.minY > a.maxY)
+                {
+                    continue;
+                }
+                if ((a.isStatic && b.isStatic)
+                    || (a.layer & b.mask) == 0 || (b.layer & a.mask) == 0)
+                {
+                    continue;
+                }
+
+                ++world.stats.candidatePairs;
+                auto contact = narrowPhase(a, b, world.stats);
+                if (!contact)
+                {
+                    continue;
+                }
+
+                if (pixelPerfect.contains(a.entity) || pixelPerfect.contains(b.entity))
+                {
+                    ++world.stats.pixelTests;
+                    if (!pixelsOverlap(registry, a, b, contact->time))
+                    {
+                        continue;
+                    }
+                }
+
+                const std::uint64_t key = pairKey(a.entity, b.entity);
+                contact->a = a.entity;
+                contact->b = b.entity;
+                contact->began = !std::binary_search(world.previousPairs.begin(),
+                                                     world.previousPairs.end(), key);
+                world.pairs.push_back(key);
+                world.contacts.push_back(*contact);
+            }
+        }
+
+        // Pairs that touched last step but not this one
+        std::sort(world.pairs.begin(), world.pairs.end());
+        for (const std::uint64_t key : world.previousPairs)
+        {
+            if (!std::binary_search(world.pairs.begin(), world.pairs.end(), key))
+            {
+                world.ended.push_back({ entt::entity{ static_cast<entt::id_type>(key & 0xFFFFFFFFu) },
+                                        entt::entity{ static_cast<entt::id_type>(key >> 32) } });
+            }
+        }
+
+        world.stats.bodies = bodies.size();
+        world.stats.contacts = world.contacts.size();
+
+        // One delivery for the whole step
+        if (!world.contacts.empty())
+        {
+            world.onContacts.publish(std::span<const Contact>(world.contacts));
+        }
+    }
+
+    void spatialIndexSystem(entt::registry& registry)
+    {
+        auto* grid = registry.ctx().find<SpatialGrid>();
+        if (!grid)
+        {
+            return;
+        }
+
+        // UIBounds entities are kept in sync by signals; sprites are refreshed here.
+        // update() returns early when the sprite stays inside the same cells.
+        auto view = registry.view<SpatialProxy, SpriteComponent>(entt::exclude<Inactive, UIBounds>);
+        for (auto [entity, proxy, spriteComp] : view.each())
+        {
+            grid->update(entity, spriteComp.sprite.getGlobalBounds(), proxy.layers);
+        }
+    }
+
+    void storePreviousPositions(entt::registry& registry)
+    {
+        auto view = registry.view<RenderInterpolation, SpriteComponent>(entt::exclude<Inactive>);
+        for (auto [entity, interpolation, spriteComp] : view.each())
+        {
+            interpolation.previousPosition = spriteComp.sprite.getPosition();
+        }
+    }
+
+    void renderSystem(entt::registry& registry, sf::RenderWindow& window, bool showDebug,
+                      float interpolationAlpha)
+    {
+        // Batched sprites first: one draw call per batch
+        auto batchView = registry.view<SpriteBatch>(entt::exclude<Inactive>);
+        for (auto batchEntity : batchView)
+        {
+            batchView.get<SpriteBatch>(batchEntity).draw(window);
+        }
+
         // now renders anything with a sprite
-        auto view = registry.view<SpriteComponent>();
+        auto view = registry.view<SpriteComponent>(entt::exclude<Inactive>);
         for (auto entity : view)
         {
             const auto& spriteComp = view.get<SpriteComponent>(entity);
-            window.draw(spriteComp.sprite);
+
+            // Draw interpolated sprites offset from where the simulation put them,
+            // without touching the sprite itself
+            sf::RenderStates states;
+            sf::Vector2f offset{ 0.0f, 0.0f };
+            if (const auto* interpolation = registry.try_get<RenderInterpolation>(entity))
+            {
+                const sf::Vector2f current = spriteComp.sprite.getPosition();
+                offset = (interpolation->previousPosition - current) * (1.0f - interpolationAlpha);
+                states.transform.translate(offset);
+            }
+            window.draw(spriteComp.sprite, states);
 
             if (showDebug)
             {
                 auto bounds = spriteComp.sprite.getGlobalBounds();
+                bounds.position += offset;
 
                 //$ Debug: bounding box (red)
                 sf::RectangleShape debugBox(bounds.size);
@@ -214,39 +894,187 @@ namespace CoreSystems
         }
     }
 
+    void updateLODSystem(entt::registry& registry, sf::Time deltaTime,
+                         const sf::View& camera, sf::Vector2f focus)
+    {
+        const float dt = deltaTime.asSeconds();
+        const auto& settings = registry.ctx().emplace<UpdateLODSettings>();
+        auto& stats = registry.ctx().emplace<UpdateLODStats>();
+        auto& clock = registry.ctx().emplace<UpdateLODClock>();
+        ++clock.frame;
+        stats = {};
+
+        sf::FloatRect visibleRect(camera.getCenter() - camera.getSize() / 2.0f, camera.getSize());
+        visibleRect.position -= { settings.viewMargin, settings.viewMargin };
+        visibleRect.size += { settings.viewMargin * 2.0f, settings.viewMargin * 2.0f };
+        const float nearDistanceSq = settings.nearDistance * settings.nearDistance;
+
+        auto view = registry.view<UpdateLOD>(entt::exclude<Inactive>);
+        for (auto [entity, lod] : view.each())
+        {
+            lod.accumulated += dt;
+
+            const std::uint32_t interval = std::max<std::uint32_t>(lod.interval, 1);
+            lod.ticking = ((clock.frame + lod.phase) % interval) == 0;
+            if (!lod.ticking)
+            {
+                ++stats.skipped;
+                continue;
+            }
+
+            ++stats.ticked;
+            lod.tickDelta = lod.accumulated;
+            lod.accumulated = 0.0f;
+
+            // Only re-evaluate the interval when the entity ticks, so the per-frame cost
+            // stays proportional to the entities that actually run
+            std::optional<sf::Vector2f> position;
+            if (const auto* spriteComp = registry.try_get<SpriteComponent>(entity))
+            {
+                position = spriteComp->sprite.getPosition();
+            }
+            else if (const auto* world = registry.try_get<WorldTransform>(entity))
+            {
+                position = world->position;
+            }
+            else if (const auto* batched = registry.try_get<BatchedSprite>(entity);
+                     batched && registry.valid(batched->batch))
+            {
+                if (const auto* batch = registry.try_get<SpriteBatch>(batched->batch))
+                {
+                    position = batch->getQuadCenter(batched->quad);
+                }
+            }
+            if (!position)
+            {
+                lod.interval = 1;
+                continue;
+            }
+
+            const sf::Vector2f offset = *position - focus;
+            const bool isNear = offset.lengthSquared() <= nearDistanceSq;
+            const bool isVisible = visibleRect.contains(*position);
+
+            if (isVisible)
+            {
+                lod.interval = isNear ? 1 : settings.visibleFarInterval;
+            }
+            else
+            {
+                lod.interval = isNear ? settings.offscreenNearInterval
+                                      : settings.offscreenFarInterval;
+            }
+            // Keep the phase in range so the entity lands on its own slot of the cycle
+            lod.phase = static_cast<std::uint8_t>(
+                entt::to_entity(entity) % std::max<std::uint8_t>(lod.interval, 1));
+        }
+    }
+
+    void tweenSystem(entt::registry& registry, sf::Time deltaTime, TimeDomain domain)
+    {
+        auto* world = registry.ctx().find<TweenWorld>();
+        if (!world || world->size() == 0)
+        {
+            return;
+        }
+
+        world->advance(deltaTime, domain);
+        world->apply(registry, domain);
+    }
+
     void animationSystem(entt::registry& registry, sf::Time deltaTime)
     {
-        auto view = registry.view<SpriteComponent, AnimatorComponent>();
+        const float dt = deltaTime.asSeconds();
 
-        for (auto entity : view)
+        auto& animators = registry.storage<AnimatorComponent>();
+        const auto& inactive = registry.storage<Inactive>();
+        auto& lods = registry.storage<UpdateLOD>();
+
+        auto& scratch = registry.ctx().emplace<AnimationScratch>();
+        scratch.changed.clear();
+
+        // Pass 1: advance every timer by walking the packed animator array directly
+        // (no multi-component view joins). Long frames catch up several frames at once.
+        for (auto [entity, animator] : animators.each())
         {
-            auto& spriteComp = view.get<SpriteComponent>(entity);
-            auto& animator = view.get<AnimatorComponent>(entity);
+            if (!animator.sheet || animator.clip >= animator.sheet->getClipCount()
+                || inactive.contains(entity))
+            {
+                continue;
+            }
 
-            // Get the data for the current animation from the map in AnimatorComponent
-            Animation& currentAnim = animator.animations.at(animator.currentAnimationName);
+            const AnimationClip& clip = animator.sheet->getClip(animator.clip);
+            if (clip.timePerFrame <= 0.0f)
+            {
+                continue;
+            }
+
+            // LOD-scheduled animators only run on their tick, with the time they missed.
+            // No tick delta (updateLODSystem didn't run this step) means full rate.
+            float animatorDelta = dt;
+            if (lods.contains(entity))
+            {
+                auto& lod = lods.get(entity);
+                const bool ticking = lod.ticking;
+                const float tickDelta = lod.tickDelta;
 
-            // Add the frame time to our elapsed timer
-            animator.elapsedTime += deltaTime;
+                // Consumed: if updateLODSystem stops scheduling the entity, a stale skip
+                // would freeze it and a stale multi-frame delta would replay every step
+                lod.ticking = true;
+                lod.tickDelta = 0.0f;
 
-            // Check if we should advance to the next frame
-            if (animator.elapsedTime >= currentAnim.getTimePerFrame())
+                if (!ticking)
+                {
+                    continue;
+                }
+                if (tickDelta > 0.0f)
+                {
+                    animatorDelta = tickDelta;
+                }
+            }
+
+            animator.elapsedTime += animatorDelta;
+            if (animator.elapsedTime < clip.timePerFrame)
             {
-                // Reset the timer
-                animator.elapsedTime -= currentAnim.getTimePerFrame();
+                continue;
+            }
 
-                // Advance to the next frame, loop back to 0 if at end
-                animator.currentFrame = (animator.currentFrame + 1) % currentAnim.frames;
+            const auto steps = static_cast<unsigned int>(animator.elapsedTime / clip.timePerFrame);
+            animator.elapsedTime -= static_cast<float>(steps) * clip.timePerFrame;
+            animator.currentFrame = static_cast<std::uint8_t>(
+                                    (animator.currentFrame + steps) % clip.frameCount);
 
-                // Calculate where to move the frame to on the sprite sheet
-                sf::IntRect newRect;
-                newRect.position.x = animator.currentFrame * animator.frameSize.x;
-                newRect.position.y = currentAnim.row * animator.frameSize.y;
-                newRect.size.x = animator.frameSize.x;
-                newRect.size.y = animator.frameSize.y;
+            scratch.changed.push_back(entity);
+        }
+
+        // Pass 2: only entities whose frame changed touch their render data.
+        // Batched sprites get their UVs written straight into the batch vertices.
+        entt::entity cachedBatchEntity = entt::null;
+        SpriteBatch* cachedBatch = nullptr;
+
+        for (auto entity : scratch.changed)
+        {
+            const auto& animator = animators.get(entity);
+            const sf::IntRect& frameRect = animator.sheet->getFrameRect(animator.clip,
+                                                                        animator.currentFrame);
 
-                // Set the sprite's texture rect
-                spriteComp.sprite.setTextureRect(newRect);
+            if (auto* batched = registry.try_get<BatchedSprite>(entity))
+            {
+                if (batched->batch != cachedBatchEntity)
+                {
+                    cachedBatchEntity = batched->batch;
+                    cachedBatch = registry.valid(cachedBatchEntity)
+                                ? registry.try_get<SpriteBatch>(cachedBatchEntity)
+                                : nullptr;
+                }
+                if (cachedBatch)
+                {
+                    cachedBatch->setTextureRect(batched->quad, frameRect);
+                }
+            }
+            else if (auto* spriteComp = registry.try_get<SpriteComponent>(entity))
+            {
+                spriteComp->sprite.setTextureRect(frameRect);
             }
         }
     }
@@ -258,46 +1086,70 @@ namespace UISystems
 
     void uiHoverSystem(entt::registry& registry, sf::RenderWindow& window)
     {
-        sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-        auto view = registry.view<UIBounds>();
+        // Only re-tests when the pointer or the UI changed since the last call
+        if (auto* tracker = registry.ctx().find<HoverTracker>())
+        {
+            tracker->update(registry, window);
+        }
+    }
 
-        for (auto entity : view)
+    void layoutSystem(entt::registry& registry, const sf::View& view)
+    {
+        Layout::update(registry, { view.getCenter() - view.getSize() / 2.0f, view.getSize() });
+    }
+
+    void textBindingSystem(entt::registry& registry)
+    {
+        std::array<char, 32> buffer{};
+
+        auto view = registry.view<TextBinding, UIText>(entt::exclude<Inactive>);
+        for (auto [entity, binding, uiText] : view.each())
         {
-            const auto& bounds = view.get<UIBounds>(entity);
-            if (bounds.rect.contains(mousePos))
+            // Unchanged values cost one compare: no formatting, no glyph rebuild
+            if (!binding.source || *binding.source == binding.shownValue)
+            {
+                continue;
+            }
+
+            binding.shownValue = *binding.source;
+            const auto formattedEnd = buffer.begin() + binding.format(buffer, binding.shownValue);
+
+            // Decoded into the binding's string and copied into the text's: both keep their
+            // storage, so once they fit the longest value shown a change doesn't allocate
+            binding.shownText.clear();
+            for (auto it = buffer.begin(); it != formattedEnd;)
             {
-                registry.emplace_or_replace<UIHover>(entity);
+                char32_t codepoint = 0;
+                it = sf::Utf8::decode(it, formattedEnd, codepoint);
+                binding.shownText += codepoint;
             }
-            else if (registry.all_of<UIHover>(entity))
+            uiText.text.setString(binding.shownText);
+            if (binding.keepCentered)
             {
-                registry.remove<UIHover>(entity);
+                utils::centerOrigin(uiText.text);
             }
+            // A new size may move its neighbours in a layout
+            Layout::markDirty(registry, entity);
         }
     }
 
     void uiRenderSystem(entt::registry& registry, sf::RenderWindow& window)
     {
         // Render shapes
-        auto shapeView = registry.view<UIShape>();
+        auto shapeView = registry.view<UIShape>(entt::exclude<Inactive>);
         for (auto shapeEntity : shapeView)
         {
             auto& uiShape = shapeView.get<UIShape>(shapeEntity);
 
-            // Change color on hover
-            if (registry.all_of<UIHover>(shapeEntity))
-            {
-                uiShape.shape.setFillColor(sf::Color(100, 100, 255)); // Hover color
-            }
-            else
-            {
-                uiShape.shape.setFillColor(sf::Color::Blue); // Normal color
-            }
+            // Change color on hover (faded when the entity has a HoverBlend)
+            const float blend = hoverAmount(registry, shapeEntity);
+            uiShape.shape.setFillColor(lerpColor(sf::Color::Blue, sf::Color(100, 100, 255), blend));
 
             window.draw(uiShape.shape);
         }
 
         // Render text
-        auto textView = registry.view<UIText>();
+        auto textView = registry.view<UIText>(entt::exclude<Inactive>);
         for (auto textEntity : textView)
         {
             auto& uiText = textView.get<UIText>(textEntity);
@@ -305,13 +1157,16 @@ namespace UISystems
             // Change text color on hover for interactive UI
             if (registry.all_of<UIAction, UIBounds>(textEntity))
             {
-                if (registry.all_of<UIHover>(textEntity))
-                {
-                    uiText.text.setFillColor(sf::Color::White); // Hover text color
-                }
-                else
+                const float blend = hoverAmount(registry, textEntity);
+                uiText.text.setFillColor(lerpColor(sf::Color(200, 200, 200), sf::Color::White, blend));
+            }
+            else if (registry.all_of<UIHoverFromParent>(textEntity))
+            {
+                if (const auto* parent = registry.try_get<Parent>(textEntity);
+                    parent && registry.valid(parent->entity))
                 {
-                    uiText.text.setFillColor(sf::Color(200, 200, 200)); // Normal text color
+                    const float blend = hoverAmount(registry, parent->entity);
+                    uiText.text.setFillColor(lerpColor(sf::Color(200, 200, 200), sf::Color::White, blend));
                 }
             }
 
@@ -319,7 +1174,7 @@ namespace UISystems
         }
 
         // Render UI buttons
-        auto buttonView = registry.view<GUISprite>();
+        auto buttonView = registry.view<GUISprite>(entt::exclude<Inactive>);
         for (auto buttonEntity : buttonView)
         {
             auto& button = buttonView.get<GUISprite>(buttonEntity);
@@ -327,7 +1182,7 @@ namespace UISystems
         }
 
         // Render Red X overlay
-        auto xView = registry.view<GUIRedX>();
+        auto xView = registry.view<GUIRedX>(entt::exclude<Inactive>);
         for (auto entity : xView)
         {
             auto& redX = xView.get<GUIRedX>(entity);
@@ -339,7 +1194,7 @@ namespace UISystems
     {
         if (event.button == sf::Mouse::Button::Left)
         {
-            auto view = registry.view<UIHover, UIAction>();
+            auto view = registry.view<UIHover, UIAction>(entt::exclude<Inactive>);
             for (auto entity : view)
             {
                 auto& clickable = view.get<UIAction>(entity);
@@ -355,40 +1210,27 @@ namespace UISystems
         }
     }
 
-    void uiSettingsChecks(AppContext& context)
+    void refreshToggleOverlays(entt::registry& registry, const sf::Sprite& overlay,
+                               std::optional<SettingID> changed)
     {
-        auto* buttonRedX = context.m_ResourceManager->getResource<sf::Texture>(
-                                                                Assets::Textures::ButtonRedX);
-        if (!buttonRedX)
+        auto buttonView = registry.view<GUISprite, UIToggleCond>();
+        for (auto [buttonEntity, buttonSprite, condition] : buttonView.each())
         {
-            return;
-        }
-
-        auto redXSprite = sf::Sprite(*buttonRedX);
-        utils::centerOrigin(redXSprite);
-
-        auto& registry = context.m_Registry;
+            if (changed && condition.setting != *changed)
+            {
+                continue;
+            }
 
-        auto buttonView = registry->view<GUISprite, UIToggleCond>();
-        for (auto buttonEntity : buttonView)
-        {
-            auto& condition = buttonView.get<UIToggleCond>(buttonEntity);
-            if (condition.shouldShowOverlay())
+            const bool showOverlay = condition.shouldShowOverlay && condition.shouldShowOverlay();
+            const bool hasOverlay = registry.all_of<GUIRedX>(buttonEntity);
+            if (showOverlay && !hasOverlay)
             {
-                if (!registry->all_of<GUIRedX>(buttonEntity))
-                {
-                    auto& buttonSprite = registry->get<GUISprite>(buttonEntity);
-                    auto buttonCenter = buttonSprite.sprite.getGlobalBounds().getCenter();
-                    redXSprite.setPosition(buttonCenter);
-                    registry->emplace<GUIRedX>(buttonEntity, redXSprite);
-                }
+                auto& redX = registry.emplace<GUIRedX>(buttonEntity, overlay);
+                redX.sprite.setPosition(buttonSprite.sprite.getGlobalBounds().getCenter());
             }
-            else
+            else if (!showOverlay && hasOverlay)
             {
-                if (registry->all_of<GUIRedX>(buttonEntity))
-                {
-                    registry->remove<GUIRedX>(buttonEntity);
-                }
+                registry.remove<GUIRedX>(buttonEntity);
             }
         }
     }
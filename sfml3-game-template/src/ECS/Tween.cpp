@@ -0,0 +1,469 @@
+#include "ECS/Tween.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "ECS/Hierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define TWEEN_SSE2 1
+#endif
+
+namespace
+{
+    //$ ----- Kernels ----- //
+
+    // elapsed += dt, progress = min(elapsed / duration, 1)
+    void stepTime(float* elapsed, const float* invDuration, float* progress,
+                  std::size_t count, float deltaSeconds)
+    {
+        std::size_t i = 0;
+#ifdef TWEEN_SSE2
+        const __m128 dt = _mm_set1_ps(deltaSeconds);
+        const __m128 one = _mm_set1_ps(1.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 e = _mm_add_ps(_mm_loadu_ps(elapsed + i), dt);
+            _mm_storeu_ps(elapsed + i, e);
+            _mm_storeu_ps(progress + i, _mm_min_ps(_mm_mul_ps(e, _mm_loadu_ps(invDuration + i)), one));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            elapsed[i] += deltaSeconds;
+            progress[i] = std::min(elapsed[i] * invDuration[i], 1.0f);
+        }
+    }
+
+    // One curve over a whole batch: no per-tween dispatch, and every body is branch-free
+    // (the selects compile to blends), so the loops vectorise
+    template<typename Curve>
+    void easeAll(float* t, std::size_t count, Curve curve)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            t[i] = curve(t[i]);
+        }
+    }
+
+    void ease(Easing easing, float* t, std::size_t count)
+    {
+        switch (easing)
+        {
+        case Easing::Linear:
+            break;
+        case Easing::QuadIn:
+            easeAll(t, count, [](float x) { return x * x; });
+            break;
+        case Easing::QuadOut:
+            easeAll(t, count, [](float x) { return x * (2.0f - x); });
+            break;
+        case Easing::QuadInOut:
+            easeAll(t, count, [](float x)
+            {
+                return x < 0.5f ? 2.0f * x * x : -1.0f + (4.0f - 2.0f * x) * x;
+            });
+            break;
+        case Easing::CubicIn:
+            easeAll(t, count, [](float x) { return x * x * x; });
+            break;
+        case Easing::CubicOut:
+            easeAll(t, count, [](float x)
+            {
+                const float u = x - 1.0f;
+                return u * u * u + 1.0f;
+            });
+            break;
+        case Easing::CubicInOut:
+            easeAll(t, count, [](float x)
+            {
+                const float u = 2.0f * x - 2.0f;
+                return x < 0.5f ? 4.0f * x * x * x : 0.5f * u * u * u + 1.0f;
+            });
+            break;
+        case Easing::BackOut:
+            easeAll(t, count, [](float x)
+            {
+                constexpr float c1 = 1.70158f;
+                constexpr float c3 = c1 + 1.0f;
+                const float u = x - 1.0f;
+                return 1.0f + c3 * u * u * u + c1 * u * u;
+            });
+            break;
+        case Easing::SmoothStep:
+            easeAll(t, count, [](float x) { return x * x * (3.0f - 2.0f * x); });
+            break;
+        case Easing::Count:
+            break;
+        }
+    }
+
+    // value = start + delta * progress
+    void interpolate(const float* start, const float* delta, const float* progress,
+                     float* value, std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef TWEEN_SSE2
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 v = _mm_add_ps(_mm_loadu_ps(start + i),
+                                        _mm_mul_ps(_mm_loadu_ps(delta + i), _mm_loadu_ps(progress + i)));
+            _mm_storeu_ps(value + i, v);
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            value[i] = start[i] + delta[i] * progress[i];
+        }
+    }
+
+    //$ ----- Typed accessors ----- //
+
+    std::uint8_t toChannel(float value)
+    {
+        return static_cast<std::uint8_t>(std::clamp(std::lround(value), 0l, 255l));
+    }
+
+    sf::Color toColor(const TweenValue& value)
+    {
+        return { toChannel(value.channels[0]), toChannel(value.channels[1]),
+                 toChannel(value.channels[2]), toChannel(value.channels[3]) };
+    }
+
+    template<typename Storage>
+    auto find(Storage& storage, entt::entity entity) -> decltype(&storage.get(entity))
+    {
+        return storage.contains(entity) ? &storage.get(entity) : nullptr;
+    }
+
+    // Storages are looked up once per apply(), not once per tween
+    struct PropertyAccess
+    {
+        entt::registry& registry;
+        entt::storage_for_t<SpriteComponent>& sprites;
+        entt::storage_for_t<UIShape>& shapes;
+        entt::storage_for_t<UIText>& texts;
+        entt::storage_for_t<LocalTransform>& locals;
+        entt::storage_for_t<HoverBlend>& blends;
+
+        explicit PropertyAccess(entt::registry& reg)
+            : registry(reg)
+            , sprites(reg.storage<SpriteComponent>())
+            , shapes(reg.storage<UIShape>())
+            , texts(reg.storage<UIText>())
+            , locals(reg.storage<LocalTransform>())
+            , blends(reg.storage<HoverBlend>())
+        {
+        }
+
+        // Nullopt if the entity doesn't have the property's component
+        std::optional<TweenValue> read(entt::entity entity, TweenProperty property)
+        {
+            switch (property)
+            {
+            case TweenProperty::SpritePosition:
+                if (auto* spriteComp = find(sprites, entity))
+                {
+                    return TweenValue::from(spriteComp->sprite.getPosition());
+                }
+                break;
+            case TweenProperty::SpriteScale:
+                if (auto* spriteComp = find(sprites, entity))
+                {
+                    return TweenValue::from(spriteComp->sprite.getScale());
+                }
+                break;
+            case TweenProperty::SpriteColor:
+                if (auto* spriteComp = find(sprites, entity))
+                {
+                    return TweenValue::from(spriteComp->sprite.getColor());
+                }
+                break;
+            case TweenProperty::ShapeFillColor:
+                if (auto* uiShape = find(shapes, entity))
+                {
+                    return TweenValue::from(uiShape->shape.getFillColor());
+                }
+                break;
+            case TweenProperty::TextFillColor:
+                if (auto* uiText = find(texts, entity))
+                {
+                    return TweenValue::from(uiText->text.getFillColor());
+                }
+                break;
+            case TweenProperty::LocalPosition:
+                if (auto* local = find(locals, entity))
+                {
+                    return TweenValue::from(local->position);
+                }
+                break;
+            case TweenProperty::HoverBlend:
+                if (auto* blend = find(blends, entity))
+                {
+                    return TweenValue::from(blend->value);
+                }
+                break;
+            }
+            return std::nullopt;
+        }
+
+        // False if the target is gone (the tween is dropped)
+        bool write(entt::entity entity, TweenProperty property, const TweenValue& value)
+        {
+            const auto& c = value.channels;
+            switch (property)
+            {
+            case TweenProperty::SpritePosition:
+                if (auto* spriteComp = find(sprites, entity))
+                {
+                    spriteComp->sprite.setPosition({ c[0], c[1] });
+                    return true;
+                }
+                break;
+            case TweenProperty::SpriteScale:
+                if (auto* spriteComp = find(sprites, entity))
+                {
+                    spriteComp->sprite.setScale({ c[0], c[1] });
+                    return true;
+                }
+                break;
+            case TweenProperty::SpriteColor:
+                if (auto* spriteComp = find(sprites, entity))
+                {
+                    spriteComp->sprite.setColor(toColor(value));
+                    return true;
+                }
+                break;
+            case TweenProperty::ShapeFillColor:
+                if (auto* uiShape = find(shapes, entity))
+                {
+                    uiShape->shape.setFillColor(toColor(value));
+                    return true;
+                }
+                break;
+            case TweenProperty::TextFillColor:
+                if (auto* uiText = find(texts, entity))
+                {
+                    uiText->text.setFillColor(toColor(value));
+                    return true;
+                }
+                break;
+            case TweenProperty::LocalPosition:
+                if (find(locals, entity))
+                {
+                    // Goes through the helper so the subtree is marked dirty
+                    Hierarchy::setLocalPosition(registry, entity, { c[0], c[1] });
+                    return true;
+                }
+                break;
+            case TweenProperty::HoverBlend:
+                if (auto* blend = find(blends, entity))
+                {
+                    blend->value = c[0];
+                    return true;
+                }
+                break;
+            }
+            return false;
+        }
+    };
+
+    //$ ----- Hover signals ----- //
+
+    constexpr float HoverFadeSeconds = 0.12f;
+
+    void onHoverEnter(entt::registry& registry, entt::entity entity)
+    {
+        if (registry.all_of<HoverBlend>(entity))
+        {
+            Tweens::to(registry, entity, TweenProperty::HoverBlend, TweenValue::from(1.0f),
+                       sf::seconds(HoverFadeSeconds), Easing::QuadOut, TimeDomain::UI);
+        }
+    }
+
+    void onHoverLeave(entt::registry& registry, entt::entity entity)
+    {
+        if (registry.all_of<HoverBlend>(entity))
+        {
+            Tweens::to(registry, entity, TweenProperty::HoverBlend, TweenValue::from(0.0f),
+                       sf::seconds(HoverFadeSeconds), Easing::QuadOut, TimeDomain::UI);
+        }
+    }
+}
+
+//$ ----- TweenWorld ----- //
+
+void TweenWorld::add(entt::entity entity, TweenProperty property, const TweenValue& start,
+                     const TweenValue& end, sf::Time duration, Easing easing, TimeDomain domain)
+{
+    remove(entity, property);
+
+    const auto batchIndex = static_cast<std::size_t>(domain) * EasingCount
+                          + static_cast<std::size_t>(easing);
+    Batch& batch = m_Batches[batchIndex];
+    const float seconds = std::max(duration.asSeconds(), 1e-4f);
+
+    m_Locations[key(entity, property)] = { static_cast<std::uint8_t>(batchIndex),
+                                           static_cast<std::uint32_t>(batch.size()) };
+    batch.entities.push_back(entity);
+    batch.properties.push_back(property);
+    batch.elapsed.push_back(0.0f);
+    batch.invDuration.push_back(1.0f / seconds);
+    batch.progress.push_back(0.0f);
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+        batch.start[c].push_back(start.channels[c]);
+        batch.delta[c].push_back(end.channels[c] - start.channels[c]);
+        batch.value[c].push_back(start.channels[c]);
+    }
+}
+
+bool TweenWorld::remove(entt::entity entity, TweenProperty property)
+{
+    auto it = m_Locations.find(key(entity, property));
+    if (it == m_Locations.end())
+    {
+        return false;
+    }
+
+    removeAt(it->second.batch, it->second.index);
+    return true;
+}
+
+void TweenWorld::removeAt(std::size_t batchIndex, std::size_t index)
+{
+    Batch& batch = m_Batches[batchIndex];
+    m_Locations.erase(key(batch.entities[index], batch.properties[index]));
+
+    // Swap-remove in every array, then fix the moved tween's location
+    const std::size_t last = batch.size() - 1;
+    auto swapPop = [index, last](auto& values)
+    {
+        values[index] = values[last];
+        values.pop_back();
+    };
+
+    swapPop(batch.entities);
+    swapPop(batch.properties);
+    swapPop(batch.elapsed);
+    swapPop(batch.invDuration);
+    swapPop(batch.progress);
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+        swapPop(batch.start[c]);
+        swapPop(batch.delta[c]);
+        swapPop(batch.value[c]);
+    }
+
+    if (index != last)
+    {
+        m_Locations[key(batch.entities[index], batch.properties[index])].index =
+            static_cast<std::uint32_t>(index);
+    }
+}
+
+void TweenWorld::advance(sf::Time deltaTime, TimeDomain domain)
+{
+    const float seconds = deltaTime.asSeconds();
+    const std::size_t first = static_cast<std::size_t>(domain) * EasingCount;
+
+    for (std::size_t b = first; b < first + EasingCount; ++b)
+    {
+        Batch& batch = m_Batches[b];
+        const std::size_t count = batch.size();
+        if (count == 0)
+        {
+            continue;
+        }
+
+        stepTime(batch.elapsed.data(), batch.invDuration.data(), batch.progress.data(), count, seconds);
+        ease(static_cast<Easing>(b - first), batch.progress.data(), count);
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            interpolate(batch.start[c].data(), batch.delta[c].data(), batch.progress.data(),
+                        batch.value[c].data(), count);
+        }
+    }
+}
+
+void TweenWorld::apply(entt::registry& registry, TimeDomain domain)
+{
+    PropertyAccess access(registry);
+    m_Stats = {};
+    const std::size_t first = static_cast<std::size_t>(domain) * EasingCount;
+
+    for (std::size_t b = first; b < first + EasingCount; ++b)
+    {
+        Batch& batch = m_Batches[b];
+        m_Done.clear();
+
+        for (std::size_t i = 0; i < batch.size(); ++i)
+        {
+            const TweenValue value{ { batch.value[0][i], batch.value[1][i],
+                                      batch.value[2][i], batch.value[3][i] } };
+            const bool alive = access.write(batch.entities[i], batch.properties[i], value);
+            if (!alive || batch.isFinished(i))
+            {
+                m_Stats.finished += alive ? 1 : 0;
+                m_Done.push_back({ static_cast<std::uint8_t>(b), static_cast<std::uint32_t>(i) });
+            }
+        }
+
+        // Highest index first, so swap-remove never moves a tween that's still to be removed
+        for (auto it = m_Done.rbegin(); it != m_Done.rend(); ++it)
+        {
+            removeAt(b, it->index);
+        }
+    }
+
+    m_Stats.active = m_Locations.size();
+}
+
+//$ ----- Tweens ----- //
+
+namespace Tweens
+{
+    void to(entt::registry& registry, entt::entity entity, TweenProperty property,
+            const TweenValue& target, sf::Time duration, Easing easing, TimeDomain domain)
+    {
+        const auto current = PropertyAccess(registry).read(entity, property);
+        if (!current)
+        {
+            return;
+        }
+
+        registry.ctx().emplace<TweenWorld>().add(entity, property, *current, target, duration,
+                                                 easing, domain);
+    }
+
+    void stop(entt::registry& registry, entt::entity entity, TweenProperty property)
+    {
+        if (auto* world = registry.ctx().find<TweenWorld>())
+        {
+            world->remove(entity, property);
+        }
+    }
+
+    void connect(entt::registry& registry)
+    {
+        registry.ctx().emplace<TweenWorld>();
+        registry.on_construct<UIHover>().connect<&onHoverEnter>();
+        registry.on_destroy<UIHover>().connect<&onHoverLeave>();
+    }
+
+    void disconnect(entt::registry& registry)
+    {
+        registry.on_construct<UIHover>().disconnect<&onHoverEnter>();
+        registry.on_destroy<UIHover>().disconnect<&onHoverLeave>();
+    }
+}
@@ -0,0 +1,234 @@
+#include "Managers/EntityPoolManager.hpp"
+
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+
+//$ ----- EntityPool ----- //
+
+EntityPool::EntityPool(entt::registry& registry, std::string_view id, Builder builder)
+    : m_Registry(registry)
+    , m_ID(id)
+    , m_Builder(std::move(builder))
+{
+}
+
+entt::entity EntityPool::acquire()
+{
+    ++m_Stats.acquires;
+
+    entt::entity entity = entt::null;
+    if (!m_Parked.empty())
+    {
+        entity = m_Parked.back();
+        m_Parked.pop_back();
+        --m_Stats.parked;
+        ++m_Stats.recycled;
+
+        m_Registry.remove<Inactive>(entity);
+        m_Registry.get<Pooled>(entity).parked = false;
+    }
+    else
+    {
+        entity = build();
+        if (entity == entt::null)
+        {
+            return entt::null;
+        }
+    }
+
+    ++m_Stats.active;
+    m_Stats.peakActive = std::max(m_Stats.peakActive, m_Stats.active);
+
+    return entity;
+}
+
+bool EntityPool::release(entt::entity entity)
+{
+    if (!m_Registry.valid(entity))
+    {
+        logger::Warn(std::format("Pool \"{}\": tried to release an invalid entity.", m_ID));
+        return false;
+    }
+
+    auto* pooled = m_Registry.try_get<Pooled>(entity);
+    if (!pooled || pooled->pool != this)
+    {
+        logger::Warn(std::format("Pool \"{}\": entity doesn't belong to this pool.", m_ID));
+        return false;
+    }
+    if (pooled->parked)
+    {
+        return false;
+    }
+
+    pooled->parked = true;
+    m_Registry.emplace<Inactive>(entity);
+    m_Parked.push_back(entity);
+
+    --m_Stats.active;
+    ++m_Stats.parked;
+
+    return true;
+}
+
+void EntityPool::prewarm(std::size_t count)
+{
+    m_Parked.reserve(m_Parked.size() + count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto entity = build();
+        if (entity == entt::null)
+        {
+            return;
+        }
+
+        m_Registry.get<Pooled>(entity).parked = true;
+        m_Registry.emplace<Inactive>(entity);
+        m_Parked.push_back(entity);
+        ++m_Stats.parked;
+    }
+}
+
+void EntityPool::clear()
+{
+    std::vector<entt::entity> owned;
+    auto view = m_Registry.view<Pooled>();
+    for (auto [entity, pooled] : view.each())
+    {
+        if (pooled.pool == this)
+        {
+            // Detach first so the on_destroy handler ignores these
+            pooled.pool = nullptr;
+            owned.push_back(entity);
+        }
+    }
+    m_Registry.destroy(owned.begin(), owned.end());
+
+    m_Parked.clear();
+    m_Stats.active = 0;
+    m_Stats.parked = 0;
+}
+
+entt::entity EntityPool::build()
+{
+    if (!m_Builder)
+    {
+        logger::Error(std::format("Pool \"{}\" has no builder. Can't create entity.", m_ID));
+        return entt::null;
+    }
+
+    auto entity = m_Registry.create();
+    m_Builder(m_Registry, entity);
+    m_Registry.emplace<Pooled>(entity, this, false);
+
+    ++m_Stats.created;
+
+    return entity;
+}
+
+void EntityPool::onDestroyed(entt::entity entity, bool wasParked)
+{
+    if (wasParked)
+    {
+        auto it = std::find(m_Parked.begin(), m_Parked.end(), entity);
+        if (it != m_Parked.end())
+        {
+            *it = m_Parked.back();
+            m_Parked.pop_back();
+            --m_Stats.parked;
+        }
+    }
+    else
+    {
+        --m_Stats.active;
+    }
+}
+
+//$ ----- EntityPoolManager ----- //
+
+EntityPoolManager::EntityPoolManager(entt::registry& registry)
+    : m_Registry(registry)
+{
+    m_Registry.on_destroy<Pooled>().connect<&EntityPoolManager::onPooledDestroyed>(*this);
+}
+
+EntityPoolManager::~EntityPoolManager()
+{
+    m_Registry.on_destroy<Pooled>().disconnect<&EntityPoolManager::onPooledDestroyed>(*this);
+}
+
+EntityPool& EntityPoolManager::createPool(std::string_view id, EntityPool::Builder builder,
+                                          std::size_t prewarmCount)
+{
+    if (auto it = m_Pools.find(id); it != m_Pools.end())
+    {
+        logger::Warn(std::format("Pool \"{}\" already exists. Replacing it.", id));
+        it->second->clear();
+        m_Pools.erase(it);
+    }
+
+    auto pool = std::make_unique<EntityPool>(m_Registry, id, std::move(builder));
+    pool->prewarm(prewarmCount);
+
+    auto& poolRef = *pool;
+    m_Pools.insert_or_assign(std::string(id), std::move(pool));
+
+    logger::Info(std::format("Pool \"{}\" created ({} prewarmed).", id, prewarmCount));
+
+    return poolRef;
+}
+
+EntityPool* EntityPoolManager::getPool(std::string_view id)
+{
+    auto it = m_Pools.find(id);
+    return (it != m_Pools.end()) ? it->second.get() : nullptr;
+}
+
+const EntityPool* EntityPoolManager::getPool(std::string_view id) const
+{
+    auto it = m_Pools.find(id);
+    return (it != m_Pools.end()) ? it->second.get() : nullptr;
+}
+
+void EntityPoolManager::destroyPool(std::string_view id)
+{
+    auto it = m_Pools.find(id);
+    if (it == m_Pools.end())
+    {
+        logger::Warn(std::format("Pool \"{}\" not found. Nothing to destroy.", id));
+        return;
+    }
+
+    it->second->clear();
+    m_Pools.erase(it);
+}
+
+void EntityPoolManager::logStats() const
+{
+    for (const auto& [id, pool] : m_Pools)
+    {
+        const auto& stats = pool->getStats();
+        logger::Info(std::format(
+            "Pool \"{}\": active {} | parked {} | peak {} | created {} | acquires {} ({} recycled)",
+            id, stats.active, stats.parked, stats.peakActive, stats.created,
+            stats.acquires, stats.recycled));
+    }
+}
+
+void EntityPoolManager::onPooledDestroyed(entt::registry& registry, entt::entity entity)
+{
+    const auto& pooled = registry.get<Pooled>(entity);
+    if (pooled.pool)
+    {
+        pooled.pool->onDestroyed(entity, pooled.parked);
+    }
+}
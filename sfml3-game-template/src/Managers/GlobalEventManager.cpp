@@ -1,28 +1,106 @@
 #include "Managers/GlobalEventManager.hpp"
 
 #include <SFML/Window/Event.hpp>
-#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Window.hpp>
 
+#include "Managers/InputManager.hpp"
+#include "Utilities/LatencyTracker.hpp"
 #include "Utilities/Logger.hpp"
 #include "AppContext.hpp"
 
+#include <optional>
+#include <type_traits>
+
+namespace
+{
+    // Window event types that are forwarded to the bus. Anything else SFML reports
+    // (joystick, touch, sensor...) is dropped at the poll; add a type here to listen to it.
+    template<typename Event, typename... Routed>
+    constexpr bool isAnyOf = (std::is_same_v<Event, Routed> || ...);
+
+    template<typename Event>
+    constexpr bool isRouted = isAnyOf<Event,
+        sf::Event::Closed,
+        sf::Event::Resized,
+        sf::Event::FocusLost,
+        sf::Event::FocusGained,
+        sf::Event::TextEntered,
+        sf::Event::KeyPressed,
+        sf::Event::KeyReleased,
+        sf::Event::MouseWheelScrolled,
+        sf::Event::MouseButtonPressed,
+        sf::Event::MouseButtonReleased,
+        sf::Event::MouseMoved,
+        sf::Event::MouseLeft>;
+
+    // Routed events that count for input latency (see LatencyTracker)
+    template<typename Event>
+    constexpr bool isInput = isAnyOf<Event,
+        sf::Event::TextEntered,
+        sf::Event::KeyPressed,
+        sf::Event::KeyReleased,
+        sf::Event::MouseWheelScrolled,
+        sf::Event::MouseButtonPressed,
+        sf::Event::MouseButtonReleased,
+        sf::Event::MouseMoved>;
+}
+
 GlobalEventManager::GlobalEventManager(AppContext* appContext)
+    : m_AppContext(appContext)
+{
+    m_Dispatcher.sink<sf::Event::Closed>().connect<&GlobalEventManager::onClosed>(*this);
+    m_Dispatcher.sink<sf::Event::KeyPressed>().connect<&GlobalEventManager::onKeyPressed>(*this);
+
+    // Can add stuff to happen on window resize, etc.
+}
+
+GlobalEventManager::~GlobalEventManager()
+{
+    m_Dispatcher.disconnect(*this);
+}
+
+void GlobalEventManager::pollWindowEvents(sf::Window& window)
+{
+    auto& latency = *m_AppContext->m_LatencyTracker;
+
+    while (const std::optional event = window.pollEvent())
+    {
+        // Stamped when it leaves the OS queue
+        const auto polledAt = utils::LatencyTracker::Clock::now();
+
+        // visit() resolves the event type through the variant's jump table; the routing
+        // decision itself is made at compile time
+        event->visit([this, &latency, polledAt](const auto& windowEvent)
+        {
+            using Event = std::decay_t<decltype(windowEvent)>;
+            if constexpr (isInput<Event>)
+            {
+                latency.inputPolled(polledAt);
+            }
+            // Delivered right away, in the order the OS reported them: a press and
+            // release of the same key within one poll must reach the InputManager in
+            // that order, which per-type queues can't guarantee
+            if constexpr (isRouted<Event>)
+            {
+                m_Dispatcher.trigger(windowEvent);
+            }
+        });
+    }
+}
+
+//$ ----- Global Handlers ----- //
+
+void GlobalEventManager::onClosed(const sf::Event::Closed&)
+{
+    m_AppContext->m_MainWindow->close();
+}
+
+void GlobalEventManager::onKeyPressed(const sf::Event::KeyPressed& event)
 {
-    m_Events.onClose = [appContext](const sf::Event::Closed&)
-	{
-		appContext->m_MainWindow->close();
-	};
-
-	m_Events.onGlobalKeyPress = [appContext](const sf::Event::KeyPressed& event)
-	{
-		if (event.scancode == sf::Keyboard::Scancode::Escape)
-		{
-			// We will want to remove this if we want escape to exit an inventory window etc.
-			logger::Info("Escape key pressed! Exiting.");
-			appContext->m_MainWindow->close();
-		}
-	};
-
-	// Can add stuff to happen on window resize, etc.
-	
-}
\ No newline at end of file
+    if (m_AppContext->m_InputManager->isBound(Action::Quit, event.scancode))
+    {
+        // We will want to remove this if we want escape to exit an inventory window etc.
+        logger::Info("Quit key pressed! Exiting.");
+        m_AppContext->m_MainWindow->close();
+    }
+}
@@ -0,0 +1,296 @@
+#include "Managers/InputManager.hpp"
+
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <toml++/toml.hpp>
+
+#include "Managers/ConfigManager.hpp"
+#include "Managers/GlobalEventManager.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+    using Scan = sf::Keyboard::Scan;
+
+    // Indexed by Action; also the keys of the [bindings] section
+    constexpr std::array<std::string_view, InputManager::ActionCount> ActionNames = {
+        "MoveUp", "MoveDown", "MoveLeft", "MoveRight",
+        "Pause", "ToggleDebug", "SlowMotion", "FastForward", "ToggleLatency", "Quit"
+    };
+
+    // Letters are looked up by offset from Scan::A; everything else by name
+    constexpr std::array<std::pair<std::string_view, sf::Keyboard::Scancode>, 52> KeyNames = {{
+        { "Num0", Scan::Num0 }, { "Num1", Scan::Num1 }, { "Num2", Scan::Num2 },
+        { "Num3", Scan::Num3 }, { "Num4", Scan::Num4 }, { "Num5", Scan::Num5 },
+        { "Num6", Scan::Num6 }, { "Num7", Scan::Num7 }, { "Num8", Scan::Num8 },
+        { "Num9", Scan::Num9 },
+        { "F1", Scan::F1 }, { "F2", Scan::F2 }, { "F3", Scan::F3 }, { "F4", Scan::F4 },
+        { "F5", Scan::F5 }, { "F6", Scan::F6 }, { "F7", Scan::F7 }, { "F8", Scan::F8 },
+        { "F9", Scan::F9 }, { "F10", Scan::F10 }, { "F11", Scan::F11 }, { "F12", Scan::F12 },
+        { "Enter", Scan::Enter }, { "Escape", Scan::Escape }, { "Backspace", Scan::Backspace },
+        { "Tab", Scan::Tab }, { "Space", Scan::Space }, { "Hyphen", Scan::Hyphen },
+        { "Equal", Scan::Equal }, { "Grave", Scan::Grave }, { "Comma", Scan::Comma },
+        { "Period", Scan::Period }, { "Slash", Scan::Slash }, { "CapsLock", Scan::CapsLock },
+        { "Insert", Scan::Insert }, { "Home", Scan::Home }, { "PageUp", Scan::PageUp },
+        { "Delete", Scan::Delete }, { "End", Scan::End }, { "PageDown", Scan::PageDown },
+        { "Right", Scan::Right }, { "Left", Scan::Left }, { "Down", Scan::Down },
+        { "Up", Scan::Up },
+        { "LControl", Scan::LControl }, { "LShift", Scan::LShift }, { "LAlt", Scan::LAlt },
+        { "RControl", Scan::RControl }, { "RShift", Scan::RShift }, { "RAlt", Scan::RAlt },
+        { "LSystem", Scan::LSystem }, { "RSystem", Scan::RSystem }
+    }};
+}
+
+//$ ----- Construction ----- //
+
+InputManager::InputManager(GlobalEventManager& events)
+    : m_Events(events)
+{
+    bindDefaults();
+
+    m_Events.sink<sf::Event::KeyPressed>().connect<&InputManager::onKeyPressed>(*this);
+    m_Events.sink<sf::Event::KeyReleased>().connect<&InputManager::onKeyReleased>(*this);
+    m_Events.sink<sf::Event::FocusLost>().connect<&InputManager::onFocusLost>(*this);
+    m_Events.sink<sf::Event::FocusGained>().connect<&InputManager::onFocusGained>(*this);
+}
+
+InputManager::~InputManager()
+{
+    m_Events.disconnect(*this);
+}
+
+void InputManager::bindDefaults()
+{
+    bind(Action::MoveUp, Scan::W);
+    bind(Action::MoveDown, Scan::S);
+    bind(Action::MoveLeft, Scan::A);
+    bind(Action::MoveRight, Scan::D);
+    bind(Action::Pause, Scan::P);
+    bind(Action::ToggleDebug, Scan::F12);
+    bind(Action::SlowMotion, Scan::F5);
+    bind(Action::FastForward, Scan::F6);
+    bind(Action::ToggleLatency, Scan::F3);
+    bind(Action::Quit, Scan::Escape);
+}
+
+//$ ----- Bindings ----- //
+
+bool InputManager::loadBindings(const ConfigManager& config, std::string_view configID)
+{
+    const toml::table* table = config.getConfigTable(configID);
+    if (!table)
+    {
+        return false;
+    }
+
+    const toml::table* bindings = (*table)["bindings"].as_table();
+    if (!bindings)
+    {
+        logger::Warn(std::format("No [bindings] section in Config [{}]; using the defaults.",
+                                 configID));
+        return false;
+    }
+
+    for (const auto& [name, node] : *bindings)
+    {
+        const auto action = parseAction(name.str());
+        if (!action)
+        {
+            logger::Warn(std::format("Unknown action \"{}\" in Config [{}].", name.str(), configID));
+            continue;
+        }
+
+        const toml::array* keys = node.as_array();
+        if (!keys)
+        {
+            logger::Warn(std::format("Binding \"{}\" in Config [{}] is not an array of keys.",
+                                     name.str(), configID));
+            continue;
+        }
+
+        // An empty array leaves the action unbound
+        unbind(*action);
+        for (const auto& element : *keys)
+        {
+            const std::optional<std::string_view> keyName = element.value<std::string_view>();
+            const auto key = keyName ? parseKey(*keyName) : std::nullopt;
+            if (!key)
+            {
+                logger::Warn(std::format("Unknown key \"{}\" for action \"{}\" in Config [{}].",
+                                         keyName.value_or("?"), name.str(), configID));
+                continue;
+            }
+            bind(*action, *key);
+        }
+    }
+
+    logger::Info(std::format("Input bindings loaded from Config [{}].", configID));
+    return true;
+}
+
+void InputManager::bind(Action action, sf::Keyboard::Scancode key)
+{
+    const auto keyIdx = keyIndex(key);
+    if (!keyIdx || action == Action::Count)
+    {
+        return;
+    }
+
+    m_KeyActions[*keyIdx].set(index(action));
+    if (std::find(m_BoundKeys.begin(), m_BoundKeys.end(), *keyIdx) == m_BoundKeys.end())
+    {
+        m_BoundKeys.push_back(*keyIdx);
+    }
+}
+
+void InputManager::unbind(Action action)
+{
+    if (action == Action::Count)
+    {
+        return;
+    }
+
+    for (auto keyIdx : m_BoundKeys)
+    {
+        m_KeyActions[keyIdx].reset(index(action));
+    }
+    std::erase_if(m_BoundKeys, [this](std::size_t keyIdx) { return m_KeyActions[keyIdx].none(); });
+}
+
+//$ ----- Frame Snapshot ----- //
+
+void InputManager::beginFrame() noexcept
+{
+    m_Pressed.reset();
+    m_Released.reset();
+}
+
+void InputManager::endFrame() noexcept
+{
+    m_Down = heldActions();
+}
+
+InputManager::ActionSet InputManager::heldActions() const noexcept
+{
+    ActionSet held;
+    for (auto keyIdx : m_BoundKeys)
+    {
+        if (m_KeysDown.test(keyIdx))
+        {
+            held |= m_KeyActions[keyIdx];
+        }
+    }
+    return held;
+}
+
+//$ ----- Queries ----- //
+
+bool InputManager::isKeyDown(sf::Keyboard::Scancode key) const noexcept
+{
+    const auto keyIdx = keyIndex(key);
+    return keyIdx && m_KeysDown.test(*keyIdx);
+}
+
+bool InputManager::isBound(Action action, sf::Keyboard::Scancode key) const noexcept
+{
+    const auto keyIdx = keyIndex(key);
+    return keyIdx && action != Action::Count && m_KeyActions[*keyIdx].test(index(action));
+}
+
+std::string_view InputManager::getActionName(Action action) noexcept
+{
+    return action == Action::Count ? std::string_view{} : ActionNames[index(action)];
+}
+
+std::optional<Action> InputManager::parseAction(std::string_view name) noexcept
+{
+    const auto it = std::find(ActionNames.begin(), ActionNames.end(), name);
+    if (it == ActionNames.end())
+    {
+        return std::nullopt;
+    }
+    return static_cast<Action>(it - ActionNames.begin());
+}
+
+std::optional<sf::Keyboard::Scancode> InputManager::parseKey(std::string_view name) noexcept
+{
+    if (name.size() == 1 && name[0] >= 'A' && name[0] <= 'Z')
+    {
+        return static_cast<sf::Keyboard::Scancode>(static_cast<int>(Scan::A) + (name[0] - 'A'));
+    }
+
+    const auto it = std::find_if(KeyNames.begin(), KeyNames.end(),
+                                 [name](const auto& entry) { return entry.first == name; });
+    if (it == KeyNames.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<std::size_t> InputManager::keyIndex(sf::Keyboard::Scancode key) noexcept
+{
+    const int value = static_cast<int>(key);
+    if (value < 0 || value >= static_cast<int>(KeyCount))
+    {
+        return std::nullopt;    // Scan::Unknown
+    }
+    return static_cast<std::size_t>(value);
+}
+
+//$ ----- Event Listeners ----- //
+
+void InputManager::onKeyPressed(const sf::Event::KeyPressed& event)
+{
+    const auto keyIdx = keyIndex(event.scancode);
+    // Key repeat sends more KeyPressed events for a held key; they aren't new presses
+    if (!keyIdx || m_KeysDown.test(*keyIdx))
+    {
+        return;
+    }
+
+    // Action-level edges, taken at the event so a release and re-press within one frame
+    // still counts: a second key for an action that is already held is not a press
+    m_Pressed |= m_KeyActions[*keyIdx] & ~heldActions();
+    m_KeysDown.set(*keyIdx);
+}
+
+void InputManager::onKeyReleased(const sf::Event::KeyReleased& event)
+{
+    const auto keyIdx = keyIndex(event.scancode);
+    if (!keyIdx || !m_KeysDown.test(*keyIdx))
+    {
+        return;
+    }
+
+    // Releasing one of two held keys is not a release
+    m_KeysDown.reset(*keyIdx);
+    m_Released |= m_KeyActions[*keyIdx] & ~heldActions();
+}
+
+void InputManager::onFocusLost(const sf::Event::FocusLost&)
+{
+    // The window gets no KeyReleased for keys let go while it is unfocused
+    m_Released |= heldActions();
+    m_KeysDown.reset();
+}
+
+void InputManager::onFocusGained(const sf::Event::FocusGained&)
+{
+    // Keys already held when focus comes back sent no KeyPressed. Ask the OS once, and
+    // only for the bound keys; they count as held, not as new presses.
+    for (auto keyIdx : m_BoundKeys)
+    {
+        if (sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Scancode>(keyIdx)))
+        {
+            m_KeysDown.set(keyIdx);
+        }
+    }
+}
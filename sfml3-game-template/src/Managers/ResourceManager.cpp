@@ -1,19 +1,96 @@
 #include "Managers/ResourceManager.hpp"
 
+#include <SFML/Audio/InputSoundFile.hpp>
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/SoundChannel.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <toml++/toml.hpp>
 
+#include "ECS/AnimationSheet.hpp"
+#include "Utilities/FileReader.hpp"
 #include "Utilities/Logger.hpp"
+#include "Utilities/ThreadPool.hpp"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <map>
 #include <string>
 #include <string_view>
 #include <format>
+#include <utility>
+#include <vector>
 
-void ResourceManager::loadAssetsFromManifest(std::string_view filepath)
+namespace
 {
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<float, std::milli>;
+
+    float elapsedMs(Clock::time_point since)
+    {
+        return Milliseconds(Clock::now() - since).count();
+    }
+
+    // Pixels of one texture, decoded on a worker
+    struct DecodedImage
+    {
+        sf::Image image;
+        bool loaded{ false };
+        float decodeMs{ 0.0f };
+    };
+
+    // Samples of one sound buffer, decoded on a worker
+    struct DecodedSound
+    {
+        std::vector<std::int16_t> samples;
+        unsigned int channelCount{ 0 };
+        unsigned int sampleRate{ 0 };
+        std::vector<sf::SoundChannel> channelMap;
+        bool loaded{ false };
+        float decodeMs{ 0.0f };
+    };
+
+    // Worker side: decodes the bytes read by the batch, touches no GL or audio device state
+    DecodedImage decodeImage(const utils::FileBuffer& file)
+    {
+        const auto start = Clock::now();
+        DecodedImage decoded;
+        decoded.loaded = file.loaded
+                         && decoded.image.loadFromMemory(file.bytes.data(), file.bytes.size());
+        decoded.decodeMs = elapsedMs(start);
+        return decoded;
+    }
+
+    DecodedSound decodeSound(const utils::FileBuffer& buffer)
+    {
+        const auto start = Clock::now();
+        DecodedSound decoded;
+
+        // The whole file is decoded here, so the bytes only need to outlive this call
+        sf::InputSoundFile file;
+        if (buffer.loaded && file.openFromMemory(buffer.bytes.data(), buffer.bytes.size()))
+        {
+            decoded.samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+            const std::uint64_t read = file.read(decoded.samples.data(), decoded.samples.size());
+            decoded.samples.resize(static_cast<std::size_t>(read));
+            decoded.channelCount = file.getChannelCount();
+            decoded.sampleRate = file.getSampleRate();
+            decoded.channelMap = file.getChannelMap();
+            decoded.loaded = true;
+        }
+
+        decoded.decodeMs = elapsedMs(start);
+        return decoded;
+    }
+}
+
+void ResourceManager::loadAssetsFromManifest(std::string_view filepath, utils::ThreadPool* threadPool)
+{
+    const auto start = Clock::now();
     toml::parse_result manifestFile = toml::parse_file(filepath);
 
     if (!manifestFile)
@@ -24,73 +101,252 @@ void ResourceManager::loadAssetsFromManifest(std::string_view filepath)
         return;
     }
 
-    // Load Fonts
-    if (auto fonts = manifestFile["fonts"].as_array())
+    auto readSection = [&manifestFile](std::string_view section)
     {
-        for (const auto& item : *fonts)
+        std::vector<ManifestEntry> entries;
+        if (auto items = manifestFile[section].as_array())
         {
-            toml::node_view view(item);
+            for (const auto& item : *items)
+            {
+                toml::node_view view(item);
 
-            std::string id = view["id"].value_or("");
-            std::string path = view["path"].value_or("");
+                std::string id = view["id"].value_or("");
+                std::string path = view["path"].value_or("");
 
-            if (!id.empty() && !path.empty())
-            {
-                loadResource<sf::Font>(id, path);
+                if (!id.empty() && !path.empty())
+                {
+                    entries.push_back({ std::move(id), std::move(path) });
+                }
             }
         }
+        return entries;
+    };
+
+    ManifestEntries entries;
+    entries.fonts = readSection("fonts");
+    entries.textures = readSection("textures");
+    entries.animations = readSection("animations");
+    entries.soundBuffers = readSection("soundbuffers");
+    entries.musics = readSection("musics");
+
+    std::vector<AssetTiming> timings;
+    const bool parallel = threadPool && threadPool->getThreadCount() > 0;
+    if (parallel)
+    {
+        loadParallel(entries, *threadPool, timings);
+    }
+    else
+    {
+        loadSerial(entries, timings);
     }
 
-    // Load Textures
-    if (auto textures = manifestFile["textures"].as_array())
+    logger::Info(std::format("Assets manifest successfully loaded from: {} in {:.2f} ms ({})",
+                             filepath, elapsedMs(start),
+                             parallel ? std::format("parallel, {} workers",
+                                                    threadPool->getThreadCount())
+                                      : std::string("serial")));
+    for (const auto& timing : timings)
     {
-        for (const auto& item : *textures)
+        const std::string_view failed = timing.loaded ? "" : " (failed)";
+        if (timing.workerMs > 0.0f)
         {
-            toml::node_view view(item);
+            logger::Info(std::format(
+                "    \"{}\": {:.2f} ms on a worker + {:.2f} ms on this thread{}",
+                timing.id, timing.workerMs, timing.mainMs, failed));
+        }
+        else
+        {
+            logger::Info(std::format("    \"{}\": {:.2f} ms{}", timing.id, timing.mainMs, failed));
+        }
+    }
+}
 
-            std::string id = view["id"].value_or("");
-            std::string path = view["path"].value_or("");
+template<typename T>
+void ResourceManager::loadTimed(const ManifestEntry& entry, std::vector<AssetTiming>& timings)
+{
+    const auto start = Clock::now();
+    loadResource<T>(entry.id, entry.path);
+    timings.push_back({ entry.id, 0.0f, elapsedMs(start), getResource<T>(entry.id) != nullptr });
+}
 
-            if (!id.empty() && !path.empty())
-            {
-                loadResource<sf::Texture>(id, path);
-            }
+void ResourceManager::loadSerial(const ManifestEntries& entries, std::vector<AssetTiming>& timings)
+{
+    for (const auto& entry : entries.fonts)
+    {
+        loadTimed<sf::Font>(entry, timings);
+    }
+    for (const auto& entry : entries.textures)
+    {
+        loadTimed<sf::Texture>(entry, timings);
+    }
+    for (const auto& entry : entries.animations)
+    {
+        loadTimed<AnimationSheet>(entry, timings);
+        buildPixelMasks(entry.id);
+    }
+    for (const auto& entry : entries.soundBuffers)
+    {
+        loadTimed<sf::SoundBuffer>(entry, timings);
+    }
+    for (const auto& entry : entries.musics)
+    {
+        loadTimed<sf::Music>(entry, timings);
+    }
+}
+
+void ResourceManager::loadParallel(const ManifestEntries& entries, utils::ThreadPool& threadPool,
+                                   std::vector<AssetTiming>& timings)
+{
+    // Every texture, sound, font and music file is read in one batch, all reads in flight
+    // at once (io_uring where available). Animation sheets are small TOML files that
+    // toml++ keeps reading itself.
+    std::vector<std::string> paths;
+    paths.reserve(entries.textures.size() + entries.soundBuffers.size()
+                  + entries.fonts.size() + entries.musics.size());
+    for (const auto* section : { &entries.textures, &entries.soundBuffers,
+                                 &entries.fonts, &entries.musics })
+    {
+        for (const auto& entry : *section)
+        {
+            paths.push_back(entry.path);
         }
     }
 
-    // Load SoundBuffers
-    if (auto soundBuffers = manifestFile["soundbuffers"].as_array())
+    const auto readStart = Clock::now();
+    utils::FileBatch batch = utils::readFiles(paths, &threadPool);
+    std::size_t totalBytes = 0;
+    for (const auto& file : batch.files)
+    {
+        totalBytes += file.bytes.size();
+    }
+    logger::Info(std::format("Read {} asset files ({:.1f} KiB) in {:.2f} ms ({})",
+                             paths.size(), static_cast<float>(totalBytes) / 1024.0f,
+                             elapsedMs(readStart), utils::toString(batch.backend)));
+
+    // The buffers are handed over in the order of 'paths'
+    std::size_t next = 0;
+
+    // Queue the heavy decodes first so the workers are busy while this thread does the rest
+    std::vector<std::future<DecodedImage>> images;
+    images.reserve(entries.textures.size());
+    for (std::size_t i = 0; i < entries.textures.size(); ++i)
     {
-        for (const auto& item : *soundBuffers)
+        images.push_back(threadPool.submit([file = std::move(batch.files[next++])]()
         {
-            toml::node_view view(item);
+            return decodeImage(file);
+        }));
+    }
 
-            std::string id = view["id"].value_or("");
-            std::string path = view["path"].value_or("");
+    std::vector<std::future<DecodedSound>> sounds;
+    sounds.reserve(entries.soundBuffers.size());
+    for (std::size_t i = 0; i < entries.soundBuffers.size(); ++i)
+    {
+        sounds.push_back(threadPool.submit([file = std::move(batch.files[next++])]()
+        {
+            return decodeSound(file);
+        }));
+    }
 
-            if (!id.empty() && !path.empty())
-            {
-                loadResource<sf::SoundBuffer>(id, path);
-            }
-        }
+    // Fonts and music only parse their headers here (glyphs and audio stream in later,
+    // from the buffers loadResource() keeps). A file that couldn't be read is handed over
+    // empty and fails to open like any other.
+    auto takeBytes = [](utils::FileBuffer& file)
+    {
+        return file.loaded ? std::move(file.bytes) : std::vector<std::byte>{};
+    };
+    for (const auto& entry : entries.fonts)
+    {
+        const auto start = Clock::now();
+        loadResource<sf::Font>(entry.id, takeBytes(batch.files[next++]), entry.path);
+        timings.push_back({ entry.id, 0.0f, elapsedMs(start),
+                            getResource<sf::Font>(entry.id) != nullptr });
+    }
+    for (const auto& entry : entries.animations)
+    {
+        loadTimed<AnimationSheet>(entry, timings);
+    }
+    for (const auto& entry : entries.musics)
+    {
+        const auto start = Clock::now();
+        loadResource<sf::Music>(entry.id, takeBytes(batch.files[next++]), entry.path);
+        timings.push_back({ entry.id, 0.0f, elapsedMs(start),
+                            getResource<sf::Music>(entry.id) != nullptr });
     }
 
-    // Load Musics
-    if (auto musics = manifestFile["musics"].as_array())
+    // Texture uploads need this thread's GL context. The decoded pixels are kept until the
+    // pixel masks are built, which saves reading the textures back from the GPU.
+    std::map<std::string, sf::Image, std::less<>> decodedImages;
+    for (std::size_t i = 0; i < entries.textures.size(); ++i)
     {
-        for (const auto& item : *musics)
+        const auto& entry = entries.textures[i];
+        DecodedImage decoded = images[i].get();
+        const auto start = Clock::now();
+
+        auto texture = std::make_unique<sf::Texture>();
+        if (!decoded.loaded || !texture->loadFromImage(decoded.image))
         {
-            toml::node_view view(item);
+            logger::Error(std::format("Failed to load texture: {}", entry.path));
+            timings.push_back({ entry.id, decoded.decodeMs, elapsedMs(start), false });
+            continue;
+        }
+        m_Textures.insert_or_assign(entry.id, std::move(texture));
+        logger::Info(std::format("Texture ID \"{}\" loaded from: {}", entry.id, entry.path));
 
-            std::string id = view["id"].value_or("");
-            std::string path = view["path"].value_or("");
+        timings.push_back({ entry.id, decoded.decodeMs, elapsedMs(start) });
+        decodedImages.insert_or_assign(entry.id, std::move(decoded.image));
+    }
 
-            if (!id.empty() && !path.empty())
-            {
-                loadResource<sf::Music>(id, path);
-            }
+    for (const auto& entry : entries.animations)
+    {
+        const auto* sheet = getResource<AnimationSheet>(entry.id);
+        const auto image = sheet ? decodedImages.find(sheet->getTextureID()) : decodedImages.end();
+        buildPixelMasks(entry.id, image != decodedImages.end() ? &image->second : nullptr);
+    }
+
+    for (std::size_t i = 0; i < entries.soundBuffers.size(); ++i)
+    {
+        const auto& entry = entries.soundBuffers[i];
+        DecodedSound decoded = sounds[i].get();
+        const auto start = Clock::now();
+
+        auto soundBuffer = std::make_unique<sf::SoundBuffer>();
+        if (!decoded.loaded
+            || !soundBuffer->loadFromSamples(decoded.samples.data(), decoded.samples.size(),
+                                             decoded.channelCount, decoded.sampleRate,
+                                             decoded.channelMap))
+        {
+            logger::Error(std::format("Failed to load sound buffer: {}", entry.path));
+            timings.push_back({ entry.id, decoded.decodeMs, elapsedMs(start), false });
+            continue;
         }
+        m_SoundBuffers.insert_or_assign(entry.id, std::move(soundBuffer));
+        logger::Info(std::format("SoundBuffer ID \"{}\" loaded from: {}", entry.id, entry.path));
+
+        timings.push_back({ entry.id, decoded.decodeMs, elapsedMs(start) });
+    }
+}
+
+void ResourceManager::buildPixelMasks(std::string_view sheetID, const sf::Image* image)
+{
+    auto* sheet = getResource<AnimationSheet>(sheetID);
+    if (!sheet || !sheet->wantsPixelMasks())
+    {
+        return;
+    }
+
+    if (image)
+    {
+        sheet->buildPixelMasks(*image);
+        return;
+    }
+
+    auto* texture = getResource<sf::Texture>(sheet->getTextureID());
+    if (!texture)
+    {
+        logger::Warn(std::format("No texture for {}; pixel masks not built.", sheetID));
+        return;
     }
 
-    logger::Info(std::format("Assets manifest successfully loaded from: {}", filepath));
-}
\ No newline at end of file
+    // One GPU read-back per sheet, at load time only
+    sheet->buildPixelMasks(texture->copyToImage());
+}
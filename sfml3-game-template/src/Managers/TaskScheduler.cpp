@@ -0,0 +1,349 @@
+#include "Managers/TaskScheduler.hpp"
+
+#include <SFML/System/Time.hpp>
+
+#include "Managers/TimeManager.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+//$ ----- Frame Pool ----- //
+
+namespace
+{
+    // Size classes of 64 bytes up to 2 KB, carved from 64 KB chunks. Freed frames go to
+    // their class's free list and are never returned to the OS.
+    struct FramePool
+    {
+        static constexpr std::size_t Granularity = 64;
+        static constexpr std::size_t MaxPooledSize = 2048;
+        static constexpr std::size_t ChunkSize = 64 * 1024;
+
+        struct FreeBlock { FreeBlock* next; };
+
+        std::array<FreeBlock*, MaxPooledSize / Granularity> freeLists{};
+        std::vector<std::unique_ptr<std::byte[]>> chunks;
+        std::byte* cursor{ nullptr };
+        std::size_t remaining{ 0 };
+    };
+
+    FramePool& framePool()
+    {
+        static FramePool pool;
+        return pool;
+    }
+
+    std::size_t sizeClass(std::size_t size)
+    {
+        return (size + FramePool::Granularity - 1) / FramePool::Granularity - 1;
+    }
+}
+
+namespace TaskFrames
+{
+    void* allocate(std::size_t size)
+    {
+        if (size > FramePool::MaxPooledSize)
+        {
+            return ::operator new(size);
+        }
+
+        FramePool& pool = framePool();
+        const std::size_t index = sizeClass(size);
+        if (FramePool::FreeBlock* block = pool.freeLists[index])
+        {
+            pool.freeLists[index] = block->next;
+            return block;
+        }
+
+        // Blocks are multiples of 64 bytes, so they keep the chunk's new-alignment
+        const std::size_t blockSize = (index + 1) * FramePool::Granularity;
+        if (pool.remaining < blockSize)
+        {
+            pool.chunks.push_back(std::make_unique_for_overwrite<std::byte[]>(FramePool::ChunkSize));
+            pool.cursor = pool.chunks.back().get();
+            pool.remaining = FramePool::ChunkSize;
+        }
+
+        void* frame = pool.cursor;
+        pool.cursor += blockSize;
+        pool.remaining -= blockSize;
+        return frame;
+    }
+
+    void deallocate(void* frame, std::size_t size) noexcept
+    {
+        if (!frame)
+        {
+            return;
+        }
+        if (size > FramePool::MaxPooledSize)
+        {
+            ::operator delete(frame, size);
+            return;
+        }
+
+        FramePool& pool = framePool();
+        const std::size_t index = sizeClass(size);
+        pool.freeLists[index] = ::new (frame) FramePool::FreeBlock{ pool.freeLists[index] };
+    }
+
+    std::size_t getReservedBytes() noexcept
+    {
+        return framePool().chunks.size() * FramePool::ChunkSize;
+    }
+}
+
+//$ ----- Task ----- //
+
+std::coroutine_handle<> Task::FinalAwaiter::await_suspend(
+    std::coroutine_handle<promise_type> handle) noexcept
+{
+    promise_type& promise = handle.promise();
+    if (promise.continuation)
+    {
+        return promise.continuation;
+    }
+
+    // A spawned task is done: the scheduler destroys its frame once it's safe
+    if (promise.scheduler)
+    {
+        promise.scheduler->markFinished(promise.root);
+    }
+    return std::noop_coroutine();
+}
+
+void Task::promise_type::unhandled_exception() const noexcept
+{
+    logger::Error("Unhandled exception in a coroutine Task. Terminating.");
+    std::terminate();
+}
+
+//$ ----- TaskScheduler ----- //
+
+TaskScheduler::~TaskScheduler()
+{
+    for (auto& root : m_Roots)
+    {
+        if (root.alive)
+        {
+            root.handle.destroy();
+        }
+    }
+}
+
+TaskHandle TaskScheduler::spawn(Task task, TimeDomain domain)
+{
+    if (!task.m_Handle)
+    {
+        logger::Warn("TaskScheduler::spawn: ignoring an empty Task.");
+        return {};
+    }
+
+    std::uint32_t index = 0;
+    if (!m_FreeRoots.empty())
+    {
+        index = m_FreeRoots.back();
+        m_FreeRoots.pop_back();
+    }
+    else
+    {
+        index = static_cast<std::uint32_t>(m_Roots.size());
+        m_Roots.emplace_back();
+    }
+
+    Root& root = m_Roots[index];
+    root.handle = std::exchange(task.m_Handle, {});
+    root.domain = domain;
+    root.alive = true;
+    root.cancelled = false;
+    ++m_TaskCount;
+
+    const TaskHandle handle{ index, root.generation };
+    root.handle.promise().scheduler = this;
+    root.handle.promise().root = handle;
+
+    resume({ handle, root.handle });
+    return handle;
+}
+
+bool TaskScheduler::cancel(TaskHandle handle)
+{
+    if (!isRunning(handle))
+    {
+        return false;
+    }
+
+    if (m_ResumeDepth > 0)
+    {
+        // Possibly the running task (or one that spawned it): destroy it afterwards
+        m_Roots[handle.index].cancelled = true;
+        m_Finished.push_back(handle);
+    }
+    else
+    {
+        destroyRoot(handle);
+    }
+    return true;
+}
+
+void TaskScheduler::cancelAll(TimeDomain domain)
+{
+    for (std::uint32_t index = 0; index < m_Roots.size(); ++index)
+    {
+        const Root& root = m_Roots[index];
+        if (root.alive && root.domain == domain)
+        {
+            cancel({ index, root.generation });
+        }
+    }
+}
+
+bool TaskScheduler::isRunning(TaskHandle handle) const noexcept
+{
+    return handle.index < m_Roots.size()
+        && m_Roots[handle.index].alive
+        && !m_Roots[handle.index].cancelled
+        && m_Roots[handle.index].generation == handle.generation;
+}
+
+void TaskScheduler::update(const TimeManager& time, sf::Time realFrameTime)
+{
+    // The world clock follows the simulation exactly (fixed steps, pause, fast-forward);
+    // the other domains run on the scaled frame time
+    for (std::size_t domain = 0; domain < DomainCount; ++domain)
+    {
+        const auto timeDomain = static_cast<TimeDomain>(domain);
+        if (timeDomain == TimeDomain::World)
+        {
+            m_Now[domain] = static_cast<double>(time.getElapsed(timeDomain).asMicroseconds()) / 1e6;
+        }
+        else
+        {
+            m_Now[domain] += static_cast<double>(time.scale(timeDomain, realFrameTime).asMicroseconds()) / 1e6;
+        }
+    }
+
+    // Tasks that wait for the next frame during this update resume next frame
+    m_Resuming.clear();
+    std::swap(m_Resuming, m_NextFrame);
+
+    for (std::size_t domain = 0; domain < DomainCount; ++domain)
+    {
+        auto& heap = m_Timed[domain];
+        while (!heap.empty() && heap.front().wakeTime <= m_Now[domain])
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            m_Resuming.push_back(heap.back().waiter);
+            heap.pop_back();
+        }
+    }
+
+    for (std::size_t i = 0; i < m_Polled.size();)
+    {
+        PolledWaiter& polled = m_Polled[i];
+        // The condition points into the task's frame: don't call it for a dead task
+        const bool alive = isRunning(polled.waiter.root);
+        if (alive && !polled.ready())
+        {
+            ++i;
+            continue;
+        }
+
+        if (alive)
+        {
+            m_Resuming.push_back(polled.waiter);
+        }
+        polled = std::move(m_Polled.back());
+        m_Polled.pop_back();
+    }
+
+    for (std::size_t i = 0; i < m_Resuming.size(); ++i)
+    {
+        resume(m_Resuming[i]);
+    }
+}
+
+void TaskScheduler::waitNextFrame(TaskHandle root, std::coroutine_handle<> handle)
+{
+    m_NextFrame.push_back({ root, handle });
+}
+
+void TaskScheduler::waitFor(TaskHandle root, std::coroutine_handle<> handle, sf::Time duration)
+{
+    const auto domain = static_cast<std::size_t>(m_Roots[root.index].domain);
+    auto& heap = m_Timed[domain];
+    heap.push_back({ m_Now[domain] + static_cast<double>(duration.asMicroseconds()) / 1e6,
+                     { root, handle } });
+    std::push_heap(heap.begin(), heap.end());
+}
+
+void TaskScheduler::waitUntil(TaskHandle root, std::coroutine_handle<> handle, Condition ready)
+{
+    m_Polled.push_back({ { root, handle }, std::move(ready) });
+}
+
+void TaskScheduler::markFinished(TaskHandle root)
+{
+    m_Finished.push_back(root);
+}
+
+void TaskScheduler::resume(const Waiter& waiter)
+{
+    // Cancelled since it started waiting
+    if (!isRunning(waiter.root))
+    {
+        return;
+    }
+
+    ++m_ResumeDepth;
+    waiter.handle.resume();
+    --m_ResumeDepth;
+
+    // A task spawned from inside another one returns here while the outer one still runs
+    if (m_ResumeDepth == 0)
+    {
+        reapFinished();
+    }
+}
+
+void TaskScheduler::destroyRoot(TaskHandle handle)
+{
+    if (handle.index >= m_Roots.size())
+    {
+        return;
+    }
+
+    Root& root = m_Roots[handle.index];
+    if (!root.alive || root.generation != handle.generation)
+    {
+        return;
+    }
+
+    root.handle.destroy();
+    root.handle = {};
+    root.alive = false;
+    root.cancelled = false;
+    ++root.generation;
+    m_FreeRoots.push_back(handle.index);
+    --m_TaskCount;
+}
+
+void TaskScheduler::reapFinished()
+{
+    // Destroying a frame can't spawn or finish tasks, so the list doesn't change under us
+    for (TaskHandle handle : m_Finished)
+    {
+        destroyRoot(handle);
+    }
+    m_Finished.clear();
+}
@@ -0,0 +1,100 @@
+#include "Managers/TimeManager.hpp"
+
+#include <SFML/System/Time.hpp>
+
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <format>
+
+namespace
+{
+    constexpr const char* domainName(TimeDomain domain)
+    {
+        switch (domain)
+        {
+            case TimeDomain::World: return "World";
+            case TimeDomain::UI:    return "UI";
+            case TimeDomain::Audio: return "Audio";
+            default:                return "Unknown";
+        }
+    }
+
+    // Achieved speed is averaged over this much real time so it doesn't flicker
+    constexpr sf::Time SpeedWindow = sf::milliseconds(500);
+}
+
+TimeManager::TimeManager()
+{
+}
+
+void TimeManager::setScale(TimeDomain domain, float scale)
+{
+    if (domain >= TimeDomain::Count)
+    {
+        return;
+    }
+
+    m_Domains[index(domain)].scale = std::clamp(scale, 0.0f, MaxScale);
+    logger::Debug(std::format("{} time scale set to {:.2f}", domainName(domain),
+                             m_Domains[index(domain)].scale));
+}
+
+void TimeManager::setPaused(TimeDomain domain, bool paused)
+{
+    if (domain >= TimeDomain::Count)
+    {
+        return;
+    }
+
+    m_Domains[index(domain)].paused = paused;
+}
+
+float TimeManager::getEffectiveScale(TimeDomain domain) const noexcept
+{
+    const auto& clock = m_Domains[index(domain)];
+    return clock.paused ? 0.0f : clock.scale;
+}
+
+sf::Time TimeManager::scale(TimeDomain domain, sf::Time realTime) const noexcept
+{
+    return realTime * getEffectiveScale(domain);
+}
+
+void TimeManager::advance(TimeDomain domain, sf::Time scaledTime) noexcept
+{
+    m_Domains[index(domain)].elapsed += scaledTime;
+}
+
+void TimeManager::setFastForward(bool enabled)
+{
+    if (m_FastForward == enabled)
+    {
+        return;
+    }
+
+    m_FastForward = enabled;
+    m_SpeedWindowReal = sf::Time::Zero;
+    m_SpeedWindowSimulated = sf::Time::Zero;
+
+    logger::Info(std::format("Fast-forward {} (CPU budget {} ms per frame)",
+                             enabled ? "on" : "off", m_FastForwardBudget.asMilliseconds()));
+}
+
+void TimeManager::setFastForwardBudget(sf::Time budget)
+{
+    m_FastForwardBudget = std::max(budget, sf::milliseconds(1));
+}
+
+void TimeManager::recordFrame(sf::Time realTime, sf::Time simulatedTime)
+{
+    m_SpeedWindowReal += realTime;
+    m_SpeedWindowSimulated += simulatedTime;
+
+    if (m_SpeedWindowReal >= SpeedWindow)
+    {
+        m_AchievedSpeed = m_SpeedWindowSimulated / m_SpeedWindowReal;
+        m_SpeedWindowReal = sf::Time::Zero;
+        m_SpeedWindowSimulated = sf::Time::Zero;
+    }
+}
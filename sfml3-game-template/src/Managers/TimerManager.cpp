@@ -0,0 +1,310 @@
+#include "Managers/TimerManager.hpp"
+
+#include <SFML/System/Time.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/Components.hpp"
+#include "Managers/TimeManager.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <utility>
+
+TimerManager::TimerManager(entt::registry& registry)
+    : m_Registry(registry)
+{
+    for (auto& wheel : m_Wheels)
+    {
+        wheel.heads.fill(None);
+    }
+
+    m_Registry.on_destroy<TimerComponent>().connect<&TimerManager::onTimerOwnerGone>(*this);
+    m_Registry.on_construct<Inactive>().connect<&TimerManager::onTimerOwnerGone>(*this);
+}
+
+TimerManager::~TimerManager()
+{
+    m_Registry.on_destroy<TimerComponent>().disconnect<&TimerManager::onTimerOwnerGone>(*this);
+    m_Registry.on_construct<Inactive>().disconnect<&TimerManager::onTimerOwnerGone>(*this);
+}
+
+void TimerManager::setTickDuration(sf::Time tickDuration)
+{
+    if (tickDuration <= sf::Time::Zero)
+    {
+        logger::Warn("TimerManager: tick duration must be positive. Keeping the old one.");
+        return;
+    }
+    m_TickDuration = tickDuration;
+}
+
+TimerHandle TimerManager::after(sf::Time delay, Callback callback, TimeDomain domain)
+{
+    return schedule(toSteps(delay), 0, std::move(callback), domain);
+}
+
+TimerHandle TimerManager::every(sf::Time interval, Callback callback, TimeDomain domain)
+{
+    const std::uint32_t steps = toSteps(interval);
+    return schedule(steps, steps, std::move(callback), domain);
+}
+
+bool TimerManager::cancel(TimerHandle handle)
+{
+    if (!isActive(handle))
+    {
+        return false;
+    }
+
+    unlink(handle.index);
+    release(handle.index);
+    return true;
+}
+
+bool TimerManager::isActive(TimerHandle handle) const noexcept
+{
+    return handle.index < m_Timers.size()
+        && m_Timers[handle.index].active
+        && m_Timers[handle.index].generation == handle.generation;
+}
+
+void TimerManager::attach(entt::entity entity, TimerHandle handle)
+{
+    if (!m_Registry.valid(entity))
+    {
+        cancel(handle);
+        return;
+    }
+
+    auto& component = m_Registry.get_or_emplace<TimerComponent>(entity);
+    // Forget timers that already finished so the list doesn't grow forever
+    std::erase_if(component.handles, [this](TimerHandle old) { return !isActive(old); });
+    component.handles.push_back(handle);
+}
+
+void TimerManager::advance(TimeDomain domain)
+{
+    Wheel& wheel = m_Wheels[static_cast<std::size_t>(domain)];
+    ++wheel.currentStep;
+
+    // Each time a lower wheel wraps around, the next higher slot moves down a level.
+    // Higher levels first so nothing is refiled into a slot that's about to be emptied.
+    int topLevel = 0;
+    while (topLevel + 1 < LevelCount
+           && (wheel.currentStep & ((std::uint64_t{ 1 } << (SlotBits * (topLevel + 1))) - 1)) == 0)
+    {
+        ++topLevel;
+    }
+    for (int level = topLevel; level > 0; --level)
+    {
+        cascade(wheel, level);
+    }
+
+    // Everything in the current level-0 slot is due now. Detach the whole list first so
+    // callbacks can freely schedule or cancel timers.
+    auto& head = wheel.heads[wheel.currentStep & SlotMask];
+    m_DueBatch.clear();
+    for (std::uint32_t index = head; index != None; index = m_Timers[index].next)
+    {
+        m_DueBatch.push_back({ index, m_Timers[index].generation });
+        m_Timers[index].slot = Unfiled;
+    }
+    head = None;
+
+    for (std::size_t i = 0; i < m_DueBatch.size(); ++i)
+    {
+        // Cancelled by an earlier callback of this batch
+        const TimerHandle handle = m_DueBatch[i];
+        if (!isActive(handle))
+        {
+            continue;
+        }
+
+        Timer& timer = m_Timers[handle.index];  // Deque: stays valid while callbacks schedule
+        m_Firing = handle.index;
+        timer.callback();
+        m_Firing = None;
+
+        if (timer.generation != handle.generation)
+        {
+            // Cancelled itself; release() left the callback alone while it was running
+            timer.callback.reset();
+            m_FreeList.push_back(handle.index);
+        }
+        else if (timer.interval > 0)
+        {
+            timer.expiry = wheel.currentStep + timer.interval;
+            file(handle.index);
+        }
+        else
+        {
+            release(handle.index);
+        }
+    }
+}
+
+void TimerManager::clear(TimeDomain domain)
+{
+    for (std::uint32_t index = 0; index < m_Timers.size(); ++index)
+    {
+        const Timer& timer = m_Timers[index];
+        if (timer.active && timer.domain == domain)
+        {
+            cancel({ index, timer.generation });
+        }
+    }
+}
+
+TimerHandle TimerManager::schedule(std::uint32_t delaySteps, std::uint32_t interval,
+                                   Callback&& callback, TimeDomain domain)
+{
+    if (!callback)
+    {
+        logger::Warn("TimerManager: ignoring a timer without a callback.");
+        return {};
+    }
+
+    std::uint32_t index = 0;
+    if (!m_FreeList.empty())
+    {
+        index = m_FreeList.back();
+        m_FreeList.pop_back();
+    }
+    else
+    {
+        index = static_cast<std::uint32_t>(m_Timers.size());
+        m_Timers.emplace_back();
+    }
+
+    Timer& timer = m_Timers[index];
+    timer.callback = std::move(callback);
+    timer.expiry = m_Wheels[static_cast<std::size_t>(domain)].currentStep + delaySteps;
+    timer.interval = interval;
+    timer.domain = domain;
+    timer.active = true;
+    ++m_ActiveCount;
+
+    file(index);
+    return { index, timer.generation };
+}
+
+std::uint32_t TimerManager::toSteps(sf::Time time) const noexcept
+{
+    const double steps = std::ceil(static_cast<double>(time.asMicroseconds())
+                                   / static_cast<double>(m_TickDuration.asMicroseconds()));
+    return static_cast<std::uint32_t>(std::clamp(
+        steps, 1.0, static_cast<double>(std::numeric_limits<std::uint32_t>::max())));
+}
+
+void TimerManager::file(std::uint32_t index)
+{
+    Timer& timer = m_Timers[index];
+    Wheel& wheel = m_Wheels[static_cast<std::size_t>(timer.domain)];
+
+    const std::uint64_t delta = timer.expiry > wheel.currentStep ? timer.expiry - wheel.currentStep : 0;
+
+    // Lowest level whose range covers the delay; the slot comes from the absolute expiry
+    int level = 0;
+    while (level + 1 < LevelCount && delta >= (std::uint64_t{ 1 } << (SlotBits * (level + 1))))
+    {
+        ++level;
+    }
+
+    std::uint64_t target = timer.expiry;
+    const std::uint64_t range = std::uint64_t{ 1 } << (SlotBits * LevelCount);
+    if (delta >= range)
+    {
+        // Beyond the last wheel: park it as far out as possible, it's refiled on cascade
+        target = wheel.currentStep + range - 1;
+    }
+
+    const std::uint32_t slot = level * SlotCount
+                             + static_cast<std::uint32_t>((target >> (SlotBits * level)) & SlotMask);
+    auto& head = wheel.heads[slot];
+
+    timer.slot = static_cast<std::uint16_t>(slot);
+    timer.prev = None;
+    timer.next = head;
+    if (head != None)
+    {
+        m_Timers[head].prev = index;
+    }
+    head = index;
+}
+
+void TimerManager::unlink(std::uint32_t index)
+{
+    Timer& timer = m_Timers[index];
+    if (timer.slot == Unfiled)
+    {
+        return;
+    }
+
+    auto& heads = m_Wheels[static_cast<std::size_t>(timer.domain)].heads;
+    if (timer.prev == None)
+    {
+        heads[timer.slot] = timer.next;
+    }
+    else
+    {
+        m_Timers[timer.prev].next = timer.next;
+    }
+    if (timer.next != None)
+    {
+        m_Timers[timer.next].prev = timer.prev;
+    }
+
+    timer.prev = None;
+    timer.next = None;
+    timer.slot = Unfiled;
+}
+
+void TimerManager::release(std::uint32_t index)
+{
+    Timer& timer = m_Timers[index];
+    timer.active = false;
+    ++timer.generation;
+    --m_ActiveCount;
+
+    // A callback cancelling its own timer: advance() finishes the release after it returns
+    if (index != m_Firing)
+    {
+        timer.callback.reset();
+        m_FreeList.push_back(index);
+    }
+}
+
+void TimerManager::cascade(Wheel& wheel, int level)
+{
+    const std::uint32_t slot = level * SlotCount
+                             + static_cast<std::uint32_t>((wheel.currentStep >> (SlotBits * level)) & SlotMask);
+
+    std::uint32_t index = wheel.heads[slot];
+    wheel.heads[slot] = None;
+    while (index != None)
+    {
+        const std::uint32_t next = m_Timers[index].next;
+        file(index);
+        index = next;
+    }
+}
+
+void TimerManager::onTimerOwnerGone(entt::registry& registry, entt::entity entity)
+{
+    auto* component = registry.try_get<TimerComponent>(entity);
+    if (!component)
+    {
+        return;
+    }
+
+    for (TimerHandle handle : component->handles)
+    {
+        cancel(handle);
+    }
+    component->handles.clear();
+}
@@ -7,21 +7,28 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
-#include <SFML/Window/Keyboard.hpp>
 
 #include "AppContext.hpp"
 #include "AppData.hpp"
 #include "AssetKeys.hpp"
+#include "Managers/InputManager.hpp"
 #include "Managers/StateManager.hpp"
+#include "Managers/TimeManager.hpp"
 #include "ECS/Components.hpp"
 #include "ECS/EntityFactory.hpp"
+#include "ECS/Layout.hpp"
+#include "ECS/Navigation.hpp"
 #include "ECS/Systems.hpp"
 #include "Utilities/Utils.hpp"
 #include "Utilities/Logger.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
 #include <memory>
 #include <format>
 #include <string>
@@ -56,10 +63,15 @@ MenuState::~MenuState()
     }
 }
 
-void MenuState::update([[maybe_unused]] sf::Time deltaTime)
+void MenuState::update(sf::Time deltaTime)
 {
+    // Resolve any moved UI before hover testing against UIBounds
+    UISystems::layoutSystem(*m_AppContext.m_Registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(*m_AppContext.m_Registry);
+
     // Call the UI hover system here
     UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    CoreSystems::tweenSystem(*m_AppContext.m_Registry, deltaTime, getTimeDomain());
 }
 
 void MenuState::render()
@@ -101,19 +113,33 @@ void MenuState::initMenuButtons()
         return;
     }
 
-    EntityFactory::createButton(m_AppContext, *buttonFont, "Play", center,
+    auto& registry = *m_AppContext.m_Registry;
+
+    // Buttons stack below the title; the layout positions them
+    auto column = EntityFactory::createLayout(m_AppContext, {
+        .mode = LayoutMode::VerticalStack,
+        .spacing = 50.0f,
+        .padding = { .top = 150.0f }
+    });
+
+    auto playButton = EntityFactory::createButton(m_AppContext, *buttonFont, "Play", center,
         [this]() {
             auto playState = std::make_unique<PlayState>(m_AppContext);
             m_AppContext.m_StateManager->replaceState(std::move(playState));
         }
     );
-    EntityFactory::createButton(m_AppContext, *buttonFont, "Settings",
-        {center.x, center.y + 150.0f},
+    auto settingsButton = EntityFactory::createButton(m_AppContext, *buttonFont, "Settings", center,
         [this]() {
             auto settingsState = std::make_unique<SettingsMenuState>(m_AppContext);
             m_AppContext.m_StateManager->replaceState(std::move(settingsState));
         }
     );
+    Layout::add(registry, column, playButton);
+    Layout::add(registry, column, settingsButton);
+
+    // Lay out now so the first frame is already in place
+    UISystems::layoutSystem(registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(registry);
 }
 
 void MenuState::assignStateEvents()
@@ -123,7 +149,8 @@ void MenuState::assignStateEvents()
     };
 
     m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
+        const auto& input = *m_AppContext.m_InputManager;
+        if (input.isBound(Action::Quit, event.scancode))
         {
             m_AppContext.m_MainWindow->close();
         }
@@ -136,6 +163,7 @@ SettingsMenuState::SettingsMenuState(AppContext& context, bool fromPlayState)
     : State(context), m_FromPlayState(fromPlayState)
 {
     initMenuButtons();
+    initToggleOverlays();
     assignStateEvents();
 
     logger::Info("SettingsMenuState initialized.");
@@ -143,6 +171,8 @@ SettingsMenuState::SettingsMenuState(AppContext& context, bool fromPlayState)
 
 SettingsMenuState::~SettingsMenuState()
 {
+    entt::sink{ m_AppContext.m_AppSettings.onChanged }.disconnect(*this);
+
     auto& registry = *m_AppContext.m_Registry;
     // Clean up SettingsMenu UI entities
     std::vector<entt::entity> entitiesToRemove;
@@ -160,22 +190,13 @@ SettingsMenuState::~SettingsMenuState()
     }
 }
 
-void SettingsMenuState::update([[maybe_unused]] sf::Time deltaTime)
+void SettingsMenuState::update(sf::Time deltaTime)
 {
+    UISystems::layoutSystem(*m_AppContext.m_Registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(*m_AppContext.m_Registry);
     UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
-    UISystems::uiSettingsChecks(m_AppContext);
-
-    // Update volume text
-    if (m_MusicVolumeText.has_value())
-    {
-        m_MusicVolumeText->setString(std::to_string(
-                            static_cast<int>(m_AppContext.m_AppSettings.musicVolume)));
-    }
-    if (m_SfxVolumeText.has_value())
-    {
-        m_SfxVolumeText->setString(std::to_string(
-                            static_cast<int>(m_AppContext.m_AppSettings.sfxVolume)));
-    }
+    CoreSystems::tweenSystem(*m_AppContext.m_Registry, deltaTime, getTimeDomain());
+    UISystems::textBindingSystem(*m_AppContext.m_Registry);
 }
 
 void SettingsMenuState::render()
@@ -183,15 +204,6 @@ void SettingsMenuState::render()
     m_AppContext.m_MainWindow->draw(m_Background);
 
     UISystems::uiRenderSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
-
-    if (m_MusicVolumeText)
-    {
-        m_AppContext.m_MainWindow->draw(*m_MusicVolumeText);
-    }
-    if (m_SfxVolumeText)
-    {
-        m_AppContext.m_MainWindow->draw(*m_SfxVolumeText);
-    }
 }
 
 void SettingsMenuState::initMenuButtons()
@@ -241,15 +253,30 @@ void SettingsMenuState::initMenuButtons()
     sf::Vector2f muteSfxPos = { center.x, center.y };
     sf::Vector2f muteMusicPos = { center.x, center.y + 100.0f };
 
-    sf::Vector2f backButtonPos = { center.x, windowSize.y - 75.0f };
+    // The controls are built at the positions above, then handed to an anchored layout that
+    // keeps each one's offset from the view center, so they stay centered on resize
+    auto& registry = *m_AppContext.m_Registry;
+    auto layout = EntityFactory::createLayout(m_AppContext, { .mode = LayoutMode::Anchored },
+                                              UITags::Settings);
+    auto keepOffset = [&registry, layout, center](entt::entity entity) {
+        sf::Vector2f boundsCenter = center;
+        if (const auto* bounds = registry.try_get<UIBounds>(entity))
+        {
+            boundsCenter = bounds->rect.getCenter();
+        }
+        else if (const auto* uiText = registry.try_get<UIText>(entity))
+        {
+            boundsCenter = uiText->text.getGlobalBounds().getCenter();
+        }
+        Layout::add(registry, layout, entity, { Anchor::Center, boundsCenter - center });
+    };
 
-    // Current sfx volume text
-    std::string sfxVolumeText = std::to_string(
-                                  static_cast<int>(m_AppContext.m_AppSettings.sfxVolume));
-    m_SfxVolumeText.emplace(*font, sfxVolumeText, 48);
-    utils::centerOrigin(*m_SfxVolumeText);
-    m_SfxVolumeText->setPosition(sfxVolumeTextPos);
-    m_SfxVolumeText->setFillColor(sf::Color(250, 250, 250));
+    // Current sfx volume text (re-formatted only when the volume changes)
+    auto sfxVolumeText = EntityFactory::createBoundText(m_AppContext, *font,
+                                   m_AppContext.m_AppSettings.sfxVolume,
+                                   sfxVolumeTextPos, UITags::Settings, 48,
+                                   sf::Color(250, 250, 250));
+    keepOffset(sfxVolumeText);
 
     // Adjust sfx volume buttons
     auto decreaseSfxVolume = [this]() {
@@ -269,25 +296,27 @@ void SettingsMenuState::initMenuButtons()
     auto rightSfxArrow = EntityFactory::createGUIButton(m_AppContext, *rightArrowButton,
                                             rightSfxArrowPos, increaseSfxVolume,
                                             UITags::Settings);
+    keepOffset(leftSfxArrow);
+    keepOffset(rightSfxArrow);
 
     // Mute SFX button
     auto toggleSfxMute = [this]() { m_AppContext.m_AppSettings.toggleSfxMute(); };
     auto muteSfxButton = EntityFactory::createLabeledButton(m_AppContext, *buttonBackground,
                             muteSfxPos, toggleSfxMute, *font, UITags::Settings, "Mute SFX",
                             36, sf::Color::White);
-    m_AppContext.m_Registry->emplace<UIToggleCond>(muteSfxButton, [this]() {
+    m_AppContext.m_Registry->emplace<UIToggleCond>(muteSfxButton, SettingID::SfxMuted, [this]() {
         return m_AppContext.m_AppSettings.sfxMuted;
     });
+    keepOffset(muteSfxButton);
 
     if (music)
     {
         // Current music volume text
-        std::string musicVolumeText = std::to_string(
-                                    static_cast<int>(m_AppContext.m_AppSettings.musicVolume));
-        m_MusicVolumeText.emplace(*font, musicVolumeText, 48);
-        utils::centerOrigin(*m_MusicVolumeText);
-        m_MusicVolumeText->setPosition(musicVolumeTextPos);
-        m_MusicVolumeText->setFillColor(sf::Color(250, 250, 250));
+        auto musicVolumeText = EntityFactory::createBoundText(m_AppContext, *font,
+                                       m_AppContext.m_AppSettings.musicVolume,
+                                       musicVolumeTextPos, UITags::Settings, 48,
+                                       sf::Color(250, 250, 250));
+        keepOffset(musicVolumeText);
 
         // Adjust Music Volume button functions
         auto decreaseMusicVolume = [this, music]() {
@@ -308,25 +337,29 @@ void SettingsMenuState::initMenuButtons()
         auto rightMusicArrow = EntityFactory::createGUIButton(m_AppContext, *rightArrowButton,
                                                 rightMusicArrowPos, increaseMusicVolume,
                                                 UITags::Settings);
+        keepOffset(leftMusicArrow);
+        keepOffset(rightMusicArrow);
 
         // Mute music button
         auto toggleMusicMute = [this]() { m_AppContext.m_AppSettings.toggleMusicMute(); };
         auto muteMusicButton = EntityFactory::createLabeledButton(m_AppContext, *buttonBackground,
                                 muteMusicPos, toggleMusicMute, *font, UITags::Settings, "Mute Music",
                                 36, sf::Color::White);
-        m_AppContext.m_Registry->emplace<UIToggleCond>(muteMusicButton, [this]() {
-            return m_AppContext.m_AppSettings.musicMuted;
-        });
+        m_AppContext.m_Registry->emplace<UIToggleCond>(muteMusicButton, SettingID::MusicMuted,
+            [this]() {
+                return m_AppContext.m_AppSettings.musicMuted;
+            });
+        keepOffset(muteMusicButton);
     }
     else
     {
         logger::Warn("Settings UI: Music resource not found. Skipping music controls.");
     }
 
-    // Back button
+    // Back button (its bottom edge 50px above the view's)
     sf::Vector2f backButtonSize = { 150.0f, 50.0f };
     auto backButton = EntityFactory::createButton(m_AppContext, *font, "Back",
-        backButtonPos,
+        center,
         [this]() {
             if (m_FromPlayState)
             {
@@ -342,6 +375,39 @@ void SettingsMenuState::initMenuButtons()
         UITags::Settings,
         backButtonSize
     );
+    Layout::add(registry, layout, backButton, { Anchor::Bottom, { 0.0f, -50.0f } });
+
+    // Lay out now so the first frame is already in place
+    UISystems::layoutSystem(registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(registry);
+}
+
+void SettingsMenuState::initToggleOverlays()
+{
+    auto* buttonRedX = m_AppContext.m_ResourceManager->getResource<sf::Texture>(
+                                                            Assets::Textures::ButtonRedX);
+    if (!buttonRedX)
+    {
+        logger::Error("Couldn't load ButtonRedX. Mute overlays won't be shown.");
+        return;
+    }
+
+    // Built once; each overlay entity gets a copy
+    m_RedXSprite.emplace(*buttonRedX);
+    utils::centerOrigin(*m_RedXSprite);
+
+    // Overlays for the current settings, then only when a setting changes
+    UISystems::refreshToggleOverlays(*m_AppContext.m_Registry, *m_RedXSprite);
+    entt::sink{ m_AppContext.m_AppSettings.onChanged }
+        .connect<&SettingsMenuState::onSettingChanged>(*this);
+}
+
+void SettingsMenuState::onSettingChanged(SettingID setting)
+{
+    if (m_RedXSprite)
+    {
+        UISystems::refreshToggleOverlays(*m_AppContext.m_Registry, *m_RedXSprite, setting);
+    }
 }
 
 void SettingsMenuState::assignStateEvents()
@@ -351,7 +417,8 @@ void SettingsMenuState::assignStateEvents()
     };
 
     m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
+        const auto& input = *m_AppContext.m_InputManager;
+        if (input.isBound(Action::Quit, event.scancode))
         {
             m_AppContext.m_MainWindow->close();
         }
@@ -367,6 +434,12 @@ PlayState::PlayState(AppContext& appContext)
     sf::Vector2f center = getWindowCenter();
     EntityFactory::createPlayer(m_AppContext, { center.x, center.y });
 
+    // Navigation grid over the play area; static colliders are stamped into it every step
+    Navigation::createGrid(*appContext.m_Registry,
+                           { { 0.0f, 0.0f }, { appContext.m_AppSettings.targetWidth,
+                                               appContext.m_AppSettings.targetHeight } },
+                           32.0f);
+
     // Handle Music
     m_Music = appContext.m_ResourceManager->getResource<sf::Music>(Assets::Musics::MainSong);
     if (!m_Music)
@@ -389,27 +462,78 @@ PlayState::PlayState(AppContext& appContext)
 
     m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event)
     {
-        // "Global" Escape key
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
+        const auto& input = *m_AppContext.m_InputManager;
+
+        // "Global" quit key
+        if (input.isBound(Action::Quit, event.scancode))
         {
             m_AppContext.m_MainWindow->close();
         }
-        // State-specific Pause key
-        else if (event.scancode == sf::Keyboard::Scancode::P)
+        // State-specific pause key
+        else if (input.isBound(Action::Pause, event.scancode))
         {
             auto pauseState = std::make_unique<PauseState>(m_AppContext);
             m_AppContext.m_StateManager->pushState(std::move(pauseState));
         }
-        else if (event.scancode == sf::Keyboard::Scancode::F12)
+        else if (input.isBound(Action::ToggleDebug, event.scancode))
         {
             m_ShowDebug = !m_ShowDebug;
             logger::Warn(std::format("Debug mode toggled: {}", m_ShowDebug ? "On" : "Off"));
+
+            if (const auto* lodStats = m_AppContext.m_Registry->ctx().find<UpdateLODStats>())
+            {
+                logger::Info(std::format("Update LOD last frame: {} ticked, {} skipped",
+                                         lodStats->ticked, lodStats->skipped));
+            }
+            if (const auto* collision = m_AppContext.m_Registry->ctx().find<CollisionWorld>())
+            {
+                logger::Info(std::format(
+                    "Collision last step: {} bodies, {} sort swaps, {} pairs, {} swept, {} contacts",
+                    collision->stats.bodies, collision->stats.sortSwaps,
+                    collision->stats.candidatePairs, collision->stats.sweptTests,
+                    collision->stats.contacts));
+            }
+            if (const auto* navigation = m_AppContext.m_Registry->ctx().find<NavigationCache>())
+            {
+                logger::Info(std::format(
+                    "Navigation last step: {} agents, {} cached fields, {} pending, {} built",
+                    navigation->stats.agents, navigation->stats.cachedFields,
+                    navigation->stats.pendingFields, navigation->stats.fieldsBuilt));
+            }
+            m_AppContext.m_FramePacer->logStats();
+            logger::Info(std::format("Simulation speed: {:.2f}x",
+                                     m_AppContext.m_TimeManager->getAchievedSpeed()));
+        }
+        // Time controls
+        else if (input.isBound(Action::SlowMotion, event.scancode))
+        {
+            cycleSlowMotion();
+        }
+        else if (input.isBound(Action::FastForward, event.scancode))
+        {
+            auto& time = *m_AppContext.m_TimeManager;
+            if (time.isFastForward())
+            {
+                logger::Info(std::format("Fast-forward reached {:.2f}x", time.getAchievedSpeed()));
+            }
+            time.setFastForward(!time.isFastForward());
         }
     };
 
     logger::Info("PlayState initialized.");
 }
 
+void PlayState::cycleSlowMotion()
+{
+    // 1x -> 0.5x -> 0.25x -> 1x. Audio follows the world so music slows down with it.
+    auto& time = *m_AppContext.m_TimeManager;
+    const float current = time.getScale(TimeDomain::World);
+    const float next = current > 0.75f ? 0.5f : (current > 0.375f ? 0.25f : 1.0f);
+
+    time.setScale(TimeDomain::World, next);
+    time.setScale(TimeDomain::Audio, next);
+}
+
 PlayState::~PlayState()
 {
     // Clean up all player entities
@@ -419,15 +543,70 @@ PlayState::~PlayState()
 
     // Here you would also clean up enemies, bullets, HUD entities, etc.
     // (e.g., registry.clear<EnemyTag, BulletTag>();)
+
+    registry.ctx().erase<NavigationCache>();
+    registry.ctx().erase<NavGrid>();
+
+    // World timers and tasks may capture this state or its entities
+    m_AppContext.m_TimerManager->clear(TimeDomain::World);
+    m_AppContext.m_TaskScheduler->cancelAll(TimeDomain::World);
+
+    // Don't leave the next game session in slow motion or fast-forward. Only the domains
+    // cycleSlowMotion() scales are reset; other scales belong to whoever set them.
+    auto& time = *m_AppContext.m_TimeManager;
+    time.setFastForward(false);
+    for (const TimeDomain domain : { TimeDomain::World, TimeDomain::Audio })
+    {
+        if (time.getScale(domain) != 1.0f)
+        {
+            time.setScale(domain, 1.0f);
+        }
+    }
+
+    // The music is a shared resource; undo the slow-motion pitch
+    if (m_Music)
+    {
+        m_Music->setPitch(1.0f);
+    }
 }
 
 void PlayState::update(sf::Time deltaTime)
 {
+    auto& registry = *m_AppContext.m_Registry;
+    const sf::View& camera = m_AppContext.m_MainWindow->getView();
+
+    // Focus update LOD around the player (or the camera if there's no player)
+    sf::Vector2f lodFocus = camera.getCenter();
+    auto playerView = registry.view<PlayerTag, SpriteComponent>();
+    for (auto player : playerView)
+    {
+        lodFocus = playerView.get<SpriteComponent>(player).sprite.getPosition();
+        break;
+    }
+
+    // Music pitch follows the audio time scale (SFML needs a pitch above 0)
+    if (m_Music)
+    {
+        const float pitch = std::max(
+            m_AppContext.m_TimeManager->getEffectiveScale(TimeDomain::Audio), 0.05f);
+        if (m_Music->getPitch() != pitch)
+        {
+            m_Music->setPitch(pitch);
+        }
+    }
+
     // Call game logic systems
     CoreSystems::handlePlayerInput(m_AppContext);
     CoreSystems::facingSystem(*m_AppContext.m_Registry);
+    CoreSystems::updateLODSystem(registry, deltaTime, camera, lodFocus);
     CoreSystems::animationSystem(*m_AppContext.m_Registry, deltaTime);
+    CoreSystems::tweenSystem(registry, deltaTime, getTimeDomain());
+    CoreSystems::navigationSystem(registry, *m_AppContext.m_ThreadPool);
     CoreSystems::movementSystem(*m_AppContext.m_Registry, deltaTime, *m_AppContext.m_MainWindow);
+    CoreSystems::collisionSystem(registry);
+    Navigation::rebuildFromColliders(registry);
+    CoreSystems::transformSystem(*m_AppContext.m_Registry);
+    CoreSystems::spatialIndexSystem(*m_AppContext.m_Registry);
 }
 
 void PlayState::render()
@@ -435,7 +614,8 @@ void PlayState::render()
     CoreSystems::renderSystem(
         *m_AppContext.m_Registry,
         *m_AppContext.m_MainWindow,
-        m_ShowDebug
+        m_ShowDebug,
+        m_AppContext.m_FrameTiming.interpolationAlpha
     );
 }
 
@@ -444,8 +624,6 @@ void PlayState::render()
 PauseState::PauseState(AppContext& context)
     : State(context)
 {
-    sf::Vector2f windowSize = { m_AppContext.m_AppSettings.targetWidth,
-                                m_AppContext.m_AppSettings.targetHeight };
     sf::Vector2f center = getWindowCenter();
 
     sf::Font* font = context.m_ResourceManager->getResource<sf::Font>(Assets::Fonts::MainFont);
@@ -472,10 +650,15 @@ PauseState::PauseState(AppContext& context)
         utils::centerOrigin(*m_PauseText);
         m_PauseText->setPosition(center);
 
+        // Buttons are placed by anchors in a layout that fills the view
+        auto& registry = *m_AppContext.m_Registry;
+        auto layout = EntityFactory::createLayout(m_AppContext, {
+            .mode = LayoutMode::Anchored
+        }, UITags::Pause);
+
         // Settings button
         sf::Vector2f buttonSize{ 200.0f, 50.0f };
-        EntityFactory::createButton(context, *font, "Settings",
-            { center.x, center.y + 100.0f },
+        auto settingsButton = EntityFactory::createButton(context, *font, "Settings", center,
             [this]() {
                 auto settingsState = std::make_unique<SettingsMenuState>(m_AppContext, true);
                 m_AppContext.m_StateManager->replaceState(std::move(settingsState));
@@ -485,10 +668,8 @@ PauseState::PauseState(AppContext& context)
         );
         
         // Back button
-        sf::Vector2f backButtonPos = { center.x, windowSize.y - 75.0f };
         sf::Vector2f backButtonSize = { 150.0f, 50.0f };
-        auto backButton = EntityFactory::createButton(m_AppContext, *backFont, "Back",
-            backButtonPos,
+        auto backButton = EntityFactory::createButton(m_AppContext, *backFont, "Back", center,
             [this, music, musicShouldResume]() {
                 if (musicShouldResume)
                 {
@@ -500,6 +681,14 @@ PauseState::PauseState(AppContext& context)
             UITags::Pause,
             backButtonSize
         );
+
+        // Padding would shift the Center anchor too, so the back button is offset instead
+        Layout::add(registry, layout, settingsButton, { Anchor::Center, { 0.0f, 100.0f } });
+        Layout::add(registry, layout, backButton, { Anchor::Bottom, { 0.0f, -50.0f } });
+
+        // Lay out now so the first frame is already in place
+        UISystems::layoutSystem(registry, m_AppContext.m_MainWindow->getView());
+        CoreSystems::transformSystem(registry);
     }
 
     m_StateEvents.onMouseButtonPress = [this](const sf::Event::MouseButtonPressed& event) {
@@ -507,11 +696,12 @@ PauseState::PauseState(AppContext& context)
         };
 
     m_StateEvents.onKeyPress = [this, music, musicShouldResume](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
+        const auto& input = *m_AppContext.m_InputManager;
+        if (input.isBound(Action::Quit, event.scancode))
         {
             m_AppContext.m_MainWindow->close();
         }
-        else if (event.scancode == sf::Keyboard::Scancode::P)
+        else if (input.isBound(Action::Pause, event.scancode))
         {
             if (musicShouldResume)
             {
@@ -522,11 +712,16 @@ PauseState::PauseState(AppContext& context)
         }
     };
 
+    // The world clock stops while the pause menu is up
+    m_AppContext.m_TimeManager->setPaused(TimeDomain::World, true);
+
     logger::Info("Game paused.");
 }
 
 PauseState::~PauseState()
 {
+    m_AppContext.m_TimeManager->setPaused(TimeDomain::World, false);
+
     auto& registry = *m_AppContext.m_Registry;
     // Clean up PauseState UI entities
     auto view = registry.view<UITagID>();
@@ -539,9 +734,12 @@ PauseState::~PauseState()
     }
 }
 
-void PauseState::update([[maybe_unused]] sf::Time deltaTime)
+void PauseState::update(sf::Time deltaTime)
 {
+    UISystems::layoutSystem(*m_AppContext.m_Registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(*m_AppContext.m_Registry);
     UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    CoreSystems::tweenSystem(*m_AppContext.m_Registry, deltaTime, getTimeDomain());
 }
 
 void PauseState::render()
@@ -599,9 +797,12 @@ GameTransitionState::~GameTransitionState()
     }
 }
 
-void GameTransitionState::update([[maybe_unused]] sf::Time deltaTime)
+void GameTransitionState::update(sf::Time deltaTime)
 {
+    UISystems::layoutSystem(*m_AppContext.m_Registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(*m_AppContext.m_Registry);
     UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    CoreSystems::tweenSystem(*m_AppContext.m_Registry, deltaTime, getTimeDomain());
 }
 
 void GameTransitionState::render()
@@ -665,10 +866,14 @@ void GameTransitionState::initMenuButtons(TransitionType type)
 
     sf::Vector2f center = getWindowCenter();
 
-    // Button positions
-    sf::Vector2f topButtonPos = { center.x, center.y - 70.0f };
-    sf::Vector2f middleButtonPos = { center.x, center.y + 50} ;
-    sf::Vector2f bottomButtonPos = { center.x, center.y + 200.0f };
+    // Button offsets from the view center (placed by an anchored layout, so they follow resizes)
+    sf::Vector2f topButtonOffset = { 0.0f, -70.0f };
+    sf::Vector2f middleButtonOffset = { 0.0f, 50.0f };
+    sf::Vector2f bottomButtonOffset = { 0.0f, 200.0f };
+
+    auto& registry = *m_AppContext.m_Registry;
+    auto layout = EntityFactory::createLayout(m_AppContext, { .mode = LayoutMode::Anchored },
+                                              UITags::Transition);
 
     bool nextLevelExists = (m_AppContext.m_AppData.levelNumber < m_AppContext.m_AppData.totalLevels);
 
@@ -677,15 +882,16 @@ void GameTransitionState::initMenuButtons(TransitionType type)
     UITags buttonTag = UITags::Transition;
 
     // Create top button
+    entt::entity topButton = entt::null;
     switch (type)
     {
         case TransitionType::LevelLoss:
             topButtonText = "Try Again";
-            EntityFactory::createButton(
+            topButton = EntityFactory::createButton(
                 m_AppContext,
                 *font,
                 topButtonText,
-                topButtonPos,
+                center,
                 [this]() {
                     logger::Info("Try Again button pressed.");
                     m_AppContext.m_AppData.levelStarted = false;
@@ -697,11 +903,11 @@ void GameTransitionState::initMenuButtons(TransitionType type)
             break;
         case TransitionType::LevelWin:
             topButtonText = "Next Level";
-            EntityFactory::createButton(
+            topButton = EntityFactory::createButton(
                 m_AppContext,
                 *font,
                 topButtonText,
-                topButtonPos,
+                center,
                 [this, nextLevelExists]() {
                     logger::Info("Next Level button pressed.");
                     m_AppContext.m_AppData.levelStarted = false;
@@ -717,11 +923,11 @@ void GameTransitionState::initMenuButtons(TransitionType type)
             break;
         case TransitionType::GameWin:
             topButtonText = "Restart";
-            EntityFactory::createButton(
+            topButton = EntityFactory::createButton(
                 m_AppContext,
                 *font,
                 topButtonText,
-                topButtonPos,
+                center,
                 [this]() {
                     logger::Info("Restart button pressed.");
                     m_AppContext.m_AppData.reset();
@@ -733,12 +939,17 @@ void GameTransitionState::initMenuButtons(TransitionType type)
             break;
     }
 
+    if (topButton != entt::null)
+    {
+        Layout::add(registry, layout, topButton, { Anchor::Center, topButtonOffset });
+    }
+
     // make the "Main Menu" button
-    EntityFactory::createButton(
+    auto mainMenuButton = EntityFactory::createButton(
         m_AppContext,
         *font,
         "Main Menu",
-        middleButtonPos,
+        center,
         [this]() {
             logger::Info("Main menu button pressed.");
             m_AppContext.m_AppData.reset();
@@ -748,18 +959,25 @@ void GameTransitionState::initMenuButtons(TransitionType type)
         buttonTag
     );
 
+    Layout::add(registry, layout, mainMenuButton, { Anchor::Center, middleButtonOffset });
+
     // make the "Quit" button
-    EntityFactory::createButton(
+    auto quitButton = EntityFactory::createButton(
         m_AppContext,
         *font,
         "Quit",
-        bottomButtonPos,
+        center,
         [this]() {
             logger::Info("Quit button pressed.");
             m_AppContext.m_MainWindow->close();
         },
         buttonTag
     );
+    Layout::add(registry, layout, quitButton, { Anchor::Center, bottomButtonOffset });
+
+    // Lay out now so the first frame is already in place
+    UISystems::layoutSystem(registry, m_AppContext.m_MainWindow->getView());
+    CoreSystems::transformSystem(registry);
 }
 
 void GameTransitionState::assignStateEvents()
@@ -769,7 +987,8 @@ void GameTransitionState::assignStateEvents()
     };
 
     m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
+        const auto& input = *m_AppContext.m_InputManager;
+        if (input.isBound(Action::Quit, event.scancode))
         {
             m_AppContext.m_MainWindow->close();
         }
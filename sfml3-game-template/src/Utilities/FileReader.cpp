@@ -0,0 +1,556 @@
+#include "Utilities/FileReader.hpp"
+
+#include "Utilities/Logger.hpp"
+#include "Utilities/ThreadPool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <future>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define SFML_TEMPLATE_POSIX_IO
+#else
+    #include <filesystem>
+    #include <fstream>
+#endif
+
+#if defined(SFML_TEMPLATE_IO_URING) && defined(__linux__)
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+
+    #include <algorithm>
+    #include <atomic>
+    #include <bit>
+    #include <chrono>
+    #include <cstring>
+    #include <mutex>
+    #include <thread>
+#else
+    #undef SFML_TEMPLATE_IO_URING
+#endif
+
+namespace
+{
+    using utils::FileBuffer;
+
+    //$ ----- Blocking Reads ----- //
+
+#if defined(SFML_TEMPLATE_POSIX_IO)
+    void readWhole(const std::string& path, FileBuffer& file)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            return;
+        }
+
+        file.bytes.resize(static_cast<std::size_t>(info.st_size));
+        std::size_t done = 0;
+        while (done < file.bytes.size())
+        {
+            const ssize_t result = ::pread(fd, file.bytes.data() + done, file.bytes.size() - done,
+                                           static_cast<off_t>(done));
+            if (result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (result <= 0)
+            {
+                break;
+            }
+            done += static_cast<std::size_t>(result);
+        }
+        ::close(fd);
+
+        file.loaded = done == file.bytes.size();
+    }
+#else
+    void readWhole(const std::string& path, FileBuffer& file)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(path, error);
+        std::ifstream stream(path, std::ios::binary);
+        if (error || !stream)
+        {
+            return;
+        }
+
+        file.bytes.resize(static_cast<std::size_t>(size));
+        stream.read(reinterpret_cast<char*>(file.bytes.data()),
+                    static_cast<std::streamsize>(file.bytes.size()));
+        file.loaded = static_cast<std::size_t>(stream.gcount()) == file.bytes.size();
+    }
+#endif
+
+    // One job per file on the pool, or one after the other without workers
+    void readBlocking(std::span<const std::string> paths, std::vector<FileBuffer>& files,
+                      std::span<const std::size_t> indices, utils::ThreadPool* threadPool)
+    {
+        if (!threadPool || threadPool->getThreadCount() == 0)
+        {
+            for (auto index : indices)
+            {
+                readWhole(paths[index], files[index]);
+            }
+            return;
+        }
+
+        // Each job writes only its own element; the vector itself isn't resized meanwhile
+        std::vector<std::future<void>> jobs;
+        jobs.reserve(indices.size());
+        for (auto index : indices)
+        {
+            jobs.push_back(threadPool->submit([&path = paths[index], &file = files[index]]()
+            {
+                readWhole(path, file);
+            }));
+        }
+        for (auto& job : jobs)
+        {
+            job.wait();
+        }
+    }
+
+    //$ ----- io_uring ----- //
+
+#if defined(SFML_TEMPLATE_IO_URING)
+    // Minimal io_uring: one submission and one completion ring, reads only
+    class IoUring
+    {
+    public:
+        explicit IoUring(unsigned int entries)
+        {
+            io_uring_params params{};
+            m_Fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (m_Fd < 0)
+            {
+                m_Error = errno;
+                return;
+            }
+
+            m_SqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+            m_CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+            m_SqRing = ::mmap(nullptr, m_SqRingSize, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, m_Fd, IORING_OFF_SQ_RING);
+            m_CqRing = ::mmap(nullptr, m_CqRingSize, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, m_Fd, IORING_OFF_CQ_RING);
+            void* sqes = ::mmap(nullptr, m_SqesSize, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, m_Fd, IORING_OFF_SQES);
+            if (m_SqRing == MAP_FAILED || m_CqRing == MAP_FAILED || sqes == MAP_FAILED)
+            {
+                m_Error = errno;
+                if (sqes != MAP_FAILED)
+                {
+                    ::munmap(sqes, m_SqesSize);
+                }
+                release();
+                return;
+            }
+            m_Sqes = static_cast<io_uring_sqe*>(sqes);
+
+            auto* sq = static_cast<std::byte*>(m_SqRing);
+            m_SqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+            m_SqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+            m_SqMask = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+            m_SqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+
+            auto* cq = static_cast<std::byte*>(m_CqRing);
+            m_CqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+            m_CqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+            m_CqMask = *reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+            m_Cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+            m_Capacity = params.sq_entries;
+        }
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        ~IoUring()
+        {
+            if (m_Sqes)
+            {
+                ::munmap(m_Sqes, m_SqesSize);
+            }
+            release();
+        }
+
+        bool isValid() const noexcept { return m_Fd >= 0; }
+        int getError() const noexcept { return m_Error; }
+        unsigned int getCapacity() const noexcept { return m_Capacity; }
+        // Queued reads the kernel hasn't taken yet
+        unsigned int getUnsubmitted() const noexcept { return m_Unsubmitted; }
+
+        // Adds a read to the submission ring; false if the ring is full
+        bool queueRead(int fd, std::byte* buffer, unsigned int length, std::uint64_t offset,
+                       std::uint64_t userData)
+        {
+            const unsigned int tail = *m_SqTail;     // Only written by us
+            const unsigned int head = std::atomic_ref(*m_SqHead).load(std::memory_order_acquire);
+            if (tail - head >= m_Capacity)
+            {
+                return false;
+            }
+
+            const unsigned int slot = tail & m_SqMask;
+            io_uring_sqe& sqe = m_Sqes[slot];
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_READ;
+            sqe.fd = fd;
+            sqe.addr = reinterpret_cast<std::uint64_t>(buffer);
+            sqe.len = length;
+            sqe.off = offset;
+            sqe.user_data = userData;
+            m_SqArray[slot] = slot;
+
+            // Publish the entry before the new tail
+            std::atomic_ref(*m_SqTail).store(tail + 1, std::memory_order_release);
+            ++m_Unsubmitted;
+            return true;
+        }
+
+        // Submits the queued reads and waits for at least one completion.
+        // Returns 0, or the errno of a failed io_uring_enter.
+        int submitAndWait()
+        {
+            while (true)
+            {
+                const long result = ::syscall(__NR_io_uring_enter, m_Fd, m_Unsubmitted, 1u,
+                                              IORING_ENTER_GETEVENTS, nullptr, 0);
+                if (result >= 0)
+                {
+                    m_Unsubmitted -= std::min(m_Unsubmitted, static_cast<unsigned int>(result));
+                    return 0;
+                }
+                if (errno != EINTR)
+                {
+                    return errno;
+                }
+            }
+        }
+
+        // Calls onComplete(userData, result) for every completion available
+        template<typename F>
+        void reap(F&& onComplete)
+        {
+            unsigned int head = *m_CqHead;           // Only written by us
+            const unsigned int tail = std::atomic_ref(*m_CqTail).load(std::memory_order_acquire);
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe& cqe = m_Cqes[head & m_CqMask];
+                onComplete(cqe.user_data, cqe.res);
+            }
+            std::atomic_ref(*m_CqHead).store(head, std::memory_order_release);
+        }
+
+    private:
+        void release()
+        {
+            if (m_SqRing && m_SqRing != MAP_FAILED)
+            {
+                ::munmap(m_SqRing, m_SqRingSize);
+            }
+            if (m_CqRing && m_CqRing != MAP_FAILED)
+            {
+                ::munmap(m_CqRing, m_CqRingSize);
+            }
+            m_SqRing = nullptr;
+            m_CqRing = nullptr;
+            if (m_Fd >= 0)
+            {
+                ::close(m_Fd);
+                m_Fd = -1;
+            }
+        }
+
+    private:
+        int m_Fd{ -1 };
+        int m_Error{ 0 };
+        unsigned int m_Capacity{ 0 };
+        unsigned int m_Unsubmitted{ 0 };
+
+        void* m_SqRing{ nullptr };
+        void* m_CqRing{ nullptr };
+        std::size_t m_SqRingSize{ 0 };
+        std::size_t m_CqRingSize{ 0 };
+        std::size_t m_SqesSize{ 0 };
+
+        unsigned int* m_SqHead{ nullptr };
+        unsigned int* m_SqTail{ nullptr };
+        unsigned int* m_SqArray{ nullptr };
+        unsigned int m_SqMask{ 0 };
+        io_uring_sqe* m_Sqes{ nullptr };
+
+        unsigned int* m_CqHead{ nullptr };
+        unsigned int* m_CqTail{ nullptr };
+        unsigned int m_CqMask{ 0 };
+        io_uring_cqe* m_Cqes{ nullptr };
+    };
+
+    // Buffers of reads abandoned on a broken ring that didn't complete in time. The kernel
+    // may still write to them, so they are kept until the process exits.
+    void keepUntilExit(std::vector<std::vector<std::byte>>&& buffers)
+    {
+        static std::mutex mutex;
+        static std::vector<std::vector<std::byte>> abandoned;
+
+        const std::scoped_lock lock(mutex);
+        for (auto& buffer : buffers)
+        {
+            abandoned.push_back(std::move(buffer));
+        }
+    }
+
+    // Returns false if no ring could be set up (nothing was read). Files the ring couldn't
+    // read for reasons a blocking read might not share (e.g. IORING_OP_READ needs Linux 5.6)
+    // are added to 'leftovers', each once, with a buffer no read in flight points into.
+    bool readWithIoUring(std::span<const std::string> paths, std::vector<FileBuffer>& files,
+                         std::vector<std::size_t>& leftovers)
+    {
+        constexpr std::size_t MaxRingEntries = 64;
+        // Large files are read in pieces so one request can't exceed the SQE length field
+        constexpr std::size_t MaxReadLength = std::size_t{ 1 } << 30;
+
+        IoUring ring(static_cast<unsigned int>(
+            std::bit_ceil(std::clamp<std::size_t>(paths.size(), 1, MaxRingEntries))));
+        if (!ring.isValid())
+        {
+            logger::Warn(std::format("io_uring unavailable (errno {}); reading with pread.",
+                                     ring.getError()));
+            return false;
+        }
+
+        struct OpenFile
+        {
+            int fd{ -1 };
+            std::size_t done{ 0 };
+            bool inFlight{ false };
+            bool leftover{ false };
+        };
+        std::vector<OpenFile> open(paths.size());
+        std::vector<std::size_t> toSubmit;
+        toSubmit.reserve(paths.size());
+
+        // Size every buffer first, so the reads go straight into their final storage
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            const int fd = ::open(paths[i].c_str(), O_RDONLY | O_CLOEXEC);
+            struct stat info{};
+            if (fd < 0 || ::fstat(fd, &info) != 0)
+            {
+                if (fd >= 0)
+                {
+                    ::close(fd);
+                }
+                continue;   // Stays !loaded; the caller logs it like any failed load
+            }
+
+            open[i].fd = fd;
+            files[i].bytes.resize(static_cast<std::size_t>(info.st_size));
+            if (files[i].bytes.empty())
+            {
+                files[i].loaded = true;
+                continue;
+            }
+            toSubmit.push_back(i);
+        }
+
+        std::size_t inFlight = 0;
+        std::vector<std::vector<std::byte>> abandoned;
+        while (!toSubmit.empty() || inFlight > 0)
+        {
+            // Keep completions within the CQ ring (twice the SQ size) by capping in-flight reads
+            while (!toSubmit.empty() && inFlight < ring.getCapacity())
+            {
+                const std::size_t index = toSubmit.back();
+                auto& bytes = files[index].bytes;
+                const std::size_t done = open[index].done;
+                const std::size_t length = std::min(bytes.size() - done, MaxReadLength);
+
+                if (!ring.queueRead(open[index].fd, bytes.data() + done,
+                                    static_cast<unsigned int>(length), done, index))
+                {
+                    break;
+                }
+                toSubmit.pop_back();
+                open[index].inFlight = true;
+                ++inFlight;
+            }
+
+            if (const int error = ring.submitAndWait(); error != 0)
+            {
+                if (error == EAGAIN || error == EBUSY)
+                {
+                    continue;   // Out of kernel resources for now; completions free them
+                }
+
+                // The ring is unusable; whatever wasn't read yet goes through pread. A read
+                // the kernel already took may still write to its buffer, so those files get
+                // a fresh one and the old one is set aside until the read is known to be over.
+                logger::Warn(std::format(
+                    "io_uring_enter failed (errno {}); reading the rest with pread.", error));
+                for (std::size_t i = 0; i < paths.size(); ++i)
+                {
+                    if (open[i].fd < 0 || files[i].loaded || open[i].leftover)
+                    {
+                        continue;
+                    }
+                    if (open[i].inFlight)
+                    {
+                        abandoned.push_back(std::move(files[i].bytes));
+                        files[i].bytes = {};
+                    }
+                    open[i].leftover = true;
+                    leftovers.push_back(i);
+                }
+                toSubmit.clear();
+                break;
+            }
+
+            ring.reap([&](std::uint64_t userData, int result)
+            {
+                const auto index = static_cast<std::size_t>(userData);
+                auto& file = files[index];
+                open[index].inFlight = false;
+                --inFlight;
+
+                if (result == -EINVAL || result == -EOPNOTSUPP)
+                {
+                    open[index].leftover = true;
+                    leftovers.push_back(index);
+                }
+                else if (result == 0)
+                {
+                    // The file shrank since fstat(); keep what is there
+                    file.bytes.resize(open[index].done);
+                    file.loaded = true;
+                }
+                else if (result > 0)
+                {
+                    open[index].done += static_cast<std::size_t>(result);
+                    if (open[index].done == file.bytes.size())
+                    {
+                        file.loaded = true;
+                    }
+                    else
+                    {
+                        toSubmit.push_back(index);      // Short read: ask for the rest
+                    }
+                }
+                // Other errors: the file stays !loaded
+            });
+        }
+
+        if (!abandoned.empty())
+        {
+            // Completions are still posted to the mapped CQ ring without io_uring_enter;
+            // wait briefly for the reads the kernel took (the unsubmitted ones never run)
+            constexpr auto MaxDrainTime = std::chrono::milliseconds(500);
+            std::size_t pending = inFlight - std::min<std::size_t>(inFlight, ring.getUnsubmitted());
+            const auto deadline = std::chrono::steady_clock::now() + MaxDrainTime;
+            while (pending > 0 && std::chrono::steady_clock::now() < deadline)
+            {
+                ring.reap([&pending](std::uint64_t, int)
+                {
+                    if (pending > 0)
+                    {
+                        --pending;
+                    }
+                });
+                if (pending > 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            if (pending > 0)
+            {
+                logger::Warn(std::format("{} io_uring reads didn't complete; keeping their "
+                                         "buffers until exit.", pending));
+                keepUntilExit(std::move(abandoned));
+            }
+        }
+
+        for (const auto& file : open)
+        {
+            if (file.fd >= 0)
+            {
+                ::close(file.fd);
+            }
+        }
+        return true;
+    }
+#endif
+}
+
+namespace utils
+{
+    FileBatch readFiles(std::span<const std::string> paths, ThreadPool* threadPool,
+                        FileReadBackend preferred)
+    {
+        FileBatch batch;
+        batch.files.resize(paths.size());
+        if (paths.empty())
+        {
+            return batch;
+        }
+
+        if (preferred == FileReadBackend::Serial)
+        {
+            threadPool = nullptr;
+        }
+
+#if defined(SFML_TEMPLATE_IO_URING)
+        std::vector<std::size_t> leftovers;
+        if (preferred == FileReadBackend::IoUring && readWithIoUring(paths, batch.files, leftovers))
+        {
+            readBlocking(paths, batch.files, leftovers, threadPool);
+            batch.backend = FileReadBackend::IoUring;
+            return batch;
+        }
+#endif
+
+        std::vector<std::size_t> all(paths.size());
+        for (std::size_t i = 0; i < all.size(); ++i)
+        {
+            all[i] = i;
+        }
+        readBlocking(paths, batch.files, all, threadPool);
+
+        const bool pooled = threadPool && threadPool->getThreadCount() > 0;
+        batch.backend = pooled ? FileReadBackend::ThreadPool : FileReadBackend::Serial;
+        return batch;
+    }
+
+    std::string_view toString(FileReadBackend backend) noexcept
+    {
+        switch (backend)
+        {
+            case FileReadBackend::IoUring:
+                return "io_uring";
+            case FileReadBackend::ThreadPool:
+                return "thread pool";
+            case FileReadBackend::Serial:
+                return "serial";
+        }
+        return "unknown";
+    }
+}
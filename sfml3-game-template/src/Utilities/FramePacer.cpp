@@ -0,0 +1,198 @@
+#include "Utilities/FramePacer.hpp"
+
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+    FramePacer::FramePacer()
+    {
+        m_FrameSamples.reserve(MaxFrameSamples);
+    }
+
+    void FramePacer::setTargetRate(unsigned int framesPerSecond)
+    {
+        m_TargetRate = framesPerSecond;
+        if (framesPerSecond == 0)
+        {
+            m_Period = Clock::duration::zero();
+        }
+        else
+        {
+            m_Period = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / static_cast<double>(framesPerSecond)));
+        }
+
+        resync();
+    }
+
+    void FramePacer::setSpinThreshold(std::chrono::microseconds threshold)
+    {
+        m_SpinThreshold = std::max(Clock::duration(threshold), Clock::duration::zero());
+    }
+
+    void FramePacer::waitForNextFrame()
+    {
+        if (m_Period == Clock::duration::zero())
+        {
+            recordFrame(Clock::now());
+            return;
+        }
+
+        if (!m_Started)
+        {
+            resync();
+        }
+
+        Clock::time_point now = Clock::now();
+
+        if (now >= m_NextDeadline)
+        {
+            ++m_MissedDeadlines;
+
+            // A slightly late frame keeps the absolute schedule, so the next one is shorter
+            // and the rate doesn't drift. Only a stall of more than a whole period re-bases
+            // on now; catching up on it would run a burst of unpaced frames.
+            if (now - m_NextDeadline > m_Period)
+            {
+                ++m_Resyncs;
+                m_NextDeadline = now + m_Period;
+            }
+            else
+            {
+                m_NextDeadline += m_Period;
+            }
+
+            recordFrame(now);
+            return;
+        }
+
+        // Coarse part: let the OS have the core until shortly before the deadline
+        const Clock::duration spinMargin = std::max(m_SpinThreshold, m_SleepOvershoot);
+        const Clock::time_point wakeTarget = m_NextDeadline - spinMargin;
+        if (now < wakeTarget)
+        {
+            std::this_thread::sleep_until(wakeTarget);
+
+            // Track how late the OS wakes us so the spin margin covers it. Decays slowly
+            // so one bad wake-up doesn't keep us spinning forever.
+            const Clock::duration overshoot = Clock::now() - wakeTarget;
+            m_SleepOvershoot = std::max(overshoot, m_SleepOvershoot - m_SleepOvershoot / 16);
+        }
+
+        // Fine part: spin the remaining tail
+        while ((now = Clock::now()) < m_NextDeadline)
+        {
+        }
+
+        // Absolute schedule: an oversleep this frame shortens the next one (no drift)
+        m_NextDeadline += m_Period;
+        recordFrame(now);
+    }
+
+    void FramePacer::resync()
+    {
+        const Clock::time_point now = Clock::now();
+        m_NextDeadline = now + m_Period;
+        m_LastFrame = now;
+        m_Started = true;
+    }
+
+    FramePacerStats FramePacer::getStats() const
+    {
+        FramePacerStats stats;
+        stats.samples = m_FrameSamples.size();
+        stats.missedDeadlines = m_MissedDeadlines;
+        stats.resyncs = m_Resyncs;
+
+        if (m_FrameSamples.empty())
+        {
+            return stats;
+        }
+
+        float sum = 0.0f;
+        for (float sample : m_FrameSamples)
+        {
+            sum += sample;
+        }
+        stats.meanFrameMs = sum / static_cast<float>(m_FrameSamples.size());
+
+        // Unpaced frames have no target, so jitter is measured against the average frame
+        const float targetMs = (m_Period != Clock::duration::zero())
+                             ? std::chrono::duration<float, std::milli>(m_Period).count()
+                             : stats.meanFrameMs;
+
+        std::vector<float> jitter;
+        jitter.reserve(m_FrameSamples.size());
+        float jitterSum = 0.0f;
+        for (float sample : m_FrameSamples)
+        {
+            const float deviation = std::abs(sample - targetMs);
+            jitter.push_back(deviation);
+            jitterSum += deviation;
+            stats.maxJitterMs = std::max(stats.maxJitterMs, deviation);
+        }
+        stats.meanJitterMs = jitterSum / static_cast<float>(jitter.size());
+
+        // Partial sorts of copies; only called when someone wants to log the numbers
+        const std::size_t p99Index = (m_FrameSamples.size() * 99) / 100;
+        std::nth_element(jitter.begin(), jitter.begin() + p99Index, jitter.end());
+        stats.p99JitterMs = jitter[p99Index];
+
+        std::vector<float> frames = m_FrameSamples;
+        std::nth_element(frames.begin(), frames.begin() + p99Index, frames.end());
+        stats.p99FrameMs = frames[p99Index];
+
+        return stats;
+    }
+
+    void FramePacer::logStats() const
+    {
+        const FramePacerStats stats = getStats();
+        logger::Info(std::format(
+            "Frame pacing over {} frames: frame mean {:.3f} ms, p99 {:.3f} ms; "
+            "jitter mean {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms; "
+            "{} missed deadlines, {} resyncs",
+            stats.samples, stats.meanFrameMs, stats.p99FrameMs,
+            stats.meanJitterMs, stats.p99JitterMs, stats.maxJitterMs,
+            stats.missedDeadlines, stats.resyncs
+        ));
+    }
+
+    void FramePacer::resetStats()
+    {
+        m_FrameSamples.clear();
+        m_NextSample = 0;
+        m_MissedDeadlines = 0;
+        m_Resyncs = 0;
+    }
+
+    void FramePacer::recordFrame(Clock::time_point now)
+    {
+        // Recorded with or without pacing, so vsync-only runs still get stats
+        if (m_Started)
+        {
+            const float frameMs = std::chrono::duration<float, std::milli>(now - m_LastFrame).count();
+
+            if (m_FrameSamples.size() < MaxFrameSamples)
+            {
+                m_FrameSamples.push_back(frameMs);
+            }
+            else
+            {
+                m_FrameSamples[m_NextSample] = frameMs;
+            }
+            m_NextSample = (m_NextSample + 1) % MaxFrameSamples;
+        }
+
+        m_LastFrame = now;
+        m_Started = true;
+    }
+}
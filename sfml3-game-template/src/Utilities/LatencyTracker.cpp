@@ -0,0 +1,198 @@
+#include "Utilities/LatencyTracker.hpp"
+
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Milliseconds = std::chrono::duration<float, std::milli>;
+
+    // Partial sort; 'values' is a scratch copy
+    float percentile(std::vector<float>& values, std::size_t percent)
+    {
+        const std::size_t index = std::min((values.size() * percent) / 100, values.size() - 1);
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+}
+
+namespace utils
+{
+    LatencyTracker::LatencyTracker()
+    {
+        m_Samples.reserve(MaxSamples);
+    }
+
+    LatencyTracker::~LatencyTracker()
+    {
+        if (m_Report.is_open() && !m_ReportSamples.empty())
+        {
+            writeReportRow(Clock::now());
+        }
+    }
+
+    //$ ----- Timestamps ----- //
+
+    void LatencyTracker::inputPolled(Clock::time_point polledAt) noexcept
+    {
+        // Only the oldest input of the frame is timed (it waited the longest)
+        if (!m_Pending)
+        {
+            m_PolledAt = polledAt;
+            m_Pending = true;
+            m_Consumed = false;
+        }
+    }
+
+    void LatencyTracker::stepStarted(Clock::time_point now) noexcept
+    {
+        if (m_Pending && !m_Consumed)
+        {
+            m_SteppedAt = now;
+            m_Consumed = true;
+        }
+    }
+
+    void LatencyTracker::framePresented(Clock::time_point now)
+    {
+        ++m_ReportFrames;
+
+        if (m_Consumed)
+        {
+            const Sample sample{ Milliseconds(now - m_PolledAt).count(),
+                                 Milliseconds(m_SteppedAt - m_PolledAt).count() };
+
+            if (m_Samples.size() < MaxSamples)
+            {
+                m_Samples.push_back(sample);
+            }
+            else
+            {
+                m_Samples[m_NextSample] = sample;
+            }
+            m_NextSample = (m_NextSample + 1) % MaxSamples;
+
+            if (m_Report.is_open())
+            {
+                m_ReportSamples.push_back(sample);
+            }
+
+            m_Pending = false;
+            m_Consumed = false;
+        }
+
+        if (m_Report.is_open() && now - m_LastReport >= m_ReportInterval)
+        {
+            writeReportRow(now);
+        }
+    }
+
+    //$ ----- Stats ----- //
+
+    LatencyStats LatencyTracker::computeStats(std::vector<Sample> samples)
+    {
+        LatencyStats stats;
+        stats.samples = samples.size();
+        if (samples.empty())
+        {
+            return stats;
+        }
+
+        std::vector<float> totals;
+        totals.reserve(samples.size());
+        float pollToStepSum = 0.0f;
+        float totalSum = 0.0f;
+        for (const Sample& sample : samples)
+        {
+            totals.push_back(sample.totalMs);
+            totalSum += sample.totalMs;
+            pollToStepSum += sample.pollToStepMs;
+            stats.maxMs = std::max(stats.maxMs, sample.totalMs);
+        }
+
+        const float count = static_cast<float>(samples.size());
+        stats.meanPollToStepMs = pollToStepSum / count;
+        stats.meanStepToPresentMs = (totalSum - pollToStepSum) / count;
+        stats.p50Ms = percentile(totals, 50);
+        stats.p95Ms = percentile(totals, 95);
+        stats.p99Ms = percentile(totals, 99);
+
+        return stats;
+    }
+
+    LatencyStats LatencyTracker::getStats() const
+    {
+        return computeStats(m_Samples);
+    }
+
+    void LatencyTracker::logStats() const
+    {
+        const LatencyStats stats = getStats();
+        logger::Info(std::format(
+            "Input latency over {} frames: p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, "
+            "max {:.2f} ms (poll->step {:.2f} ms, step->present {:.2f} ms)",
+            stats.samples, stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs,
+            stats.meanPollToStepMs, stats.meanStepToPresentMs
+        ));
+    }
+
+    void LatencyTracker::resetStats()
+    {
+        m_Samples.clear();
+        m_NextSample = 0;
+        m_Pending = false;
+        m_Consumed = false;
+    }
+
+    //$ ----- Report File ----- //
+
+    bool LatencyTracker::openReport(const std::string& path, std::chrono::milliseconds interval,
+                                    std::string_view label)
+    {
+        m_Report.close();
+        m_Report.open(path, std::ios::out | std::ios::app);
+        if (!m_Report.is_open())
+        {
+            logger::Error(std::format("Couldn't open latency stats file: {}", path));
+            return false;
+        }
+
+        m_ReportInterval = std::max(Clock::duration(interval),
+                                    Clock::duration(std::chrono::seconds(1)));
+        m_ReportStart = Clock::now();
+        m_LastReport = m_ReportStart;
+        m_ReportFrames = 0;
+        m_ReportSamples.clear();
+
+        m_Report << std::format("# {}\n", label)
+                 << "seconds,frames,samples,p50_ms,p95_ms,p99_ms,max_ms,"
+                    "poll_to_step_ms,step_to_present_ms\n";
+
+        logger::Info(std::format("Writing input latency stats to: {}", path));
+        return true;
+    }
+
+    void LatencyTracker::writeReportRow(Clock::time_point now)
+    {
+        const LatencyStats stats = computeStats(std::move(m_ReportSamples));
+        const std::chrono::duration<float> elapsed = now - m_ReportStart;
+
+        m_Report << std::format("{:.1f},{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}\n",
+                                elapsed.count(), m_ReportFrames, stats.samples,
+                                stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs,
+                                stats.meanPollToStepMs, stats.meanStepToPresentMs);
+
+        m_ReportSamples.clear();
+        m_ReportFrames = 0;
+        m_LastReport = now;
+    }
+}
@@ -0,0 +1,70 @@
+#include "Utilities/ThreadPool.hpp"
+
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+namespace utils
+{
+    ThreadPool::ThreadPool(std::size_t threadCount)
+    {
+        if (threadCount == 0)
+        {
+            const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+            threadCount = std::max<std::size_t>(hardwareThreads > 1 ? hardwareThreads - 1 : 1, 1);
+        }
+
+        m_Workers.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            m_Workers.emplace_back([this](std::stop_token stopToken) { workerLoop(stopToken); });
+        }
+
+        logger::Info(std::format("ThreadPool started with {} workers.", threadCount));
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        for (auto& worker : m_Workers)
+        {
+            worker.request_stop();
+        }
+        // jthread joins on destruction
+        m_Workers.clear();
+    }
+
+    std::size_t ThreadPool::getQueuedCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Jobs.size();
+    }
+
+    void ThreadPool::workerLoop(std::stop_token stopToken)
+    {
+        while (true)
+        {
+            std::move_only_function<void()> job;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_Condition.wait(lock, stopToken, [this] { return !m_Jobs.empty(); });
+
+                // Stop was requested and nothing is left to do
+                if (m_Jobs.empty())
+                {
+                    return;
+                }
+
+                job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+            }
+
+            job();
+        }
+    }
+}
@@ -8,7 +8,10 @@
 #include "Utilities/Logger.hpp"
 
 #include <algorithm>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string_view>
 
 void utils::boxView(sf::View &view, unsigned int windowWidth, unsigned int windowHeight)
@@ -143,3 +146,14 @@ SpritePadding utils::getSpritePadding(const sf::Sprite& sprite)
         static_cast<float>(endY - maxY - 1)     // Bottom
     };
 }
+
+std::size_t utils::formatInteger(std::span<char> buffer, float value)
+{
+    auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(),
+                                      static_cast<long>(value));
+    if (error != std::errc{})
+    {
+        return 0;
+    }
+    return static_cast<std::size_t>(end - buffer.data());
+}